@@ -1,4 +1,5 @@
 #include <benchmark/benchmark.h>
+#include <memory>
 #include <thread>
 #include "GreekCore/Numerics/Statistics.h"
 
@@ -41,9 +42,34 @@ static void BM_StatisticsMean_LockFree_Contention(benchmark::State& state) {
     }
 }
 
+// One padded Welford shard per benchmark thread.
+static void BM_StatisticsSharded_Contention(benchmark::State& state) {
+    static GreekCore::StatisticsSharded shared_gatherer(64);
+    auto& shard = shared_gatherer.shard(static_cast<size_t>(state.thread_index()));
+
+    for (auto _ : state) {
+        shard.dumpOneResult(1.0);
+    }
+}
+
+// Each thread's first result claims its own shard. Claimed shards are never released, so the
+// gatherer is rebuilt, one shard per thread, for every run (before the threads start timing).
+static void BM_StatisticsSharded_Implicit_Contention(benchmark::State& state) {
+    static std::unique_ptr<GreekCore::StatisticsSharded> shared_gatherer;
+    if (state.thread_index() == 0) {
+        shared_gatherer = std::make_unique<GreekCore::StatisticsSharded>(static_cast<size_t>(state.threads()));
+    }
+
+    for (auto _ : state) {
+        shared_gatherer->dumpOneResult(1.0);
+    }
+}
+
 BENCHMARK(BM_StatisticsMean_Mutex);
 BENCHMARK(BM_StatisticsMean_LockFree);
-BENCHMARK(BM_StatisticsMean_Mutex_Contention)->Threads(4);
-BENCHMARK(BM_StatisticsMean_LockFree_Contention)->Threads(4);
+BENCHMARK(BM_StatisticsMean_Mutex_Contention)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_StatisticsMean_LockFree_Contention)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_StatisticsSharded_Contention)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK(BM_StatisticsSharded_Implicit_Contention)->ThreadRange(1, 64)->UseRealTime();
 
 BENCHMARK_MAIN();
@@ -1,9 +1,16 @@
 #include <benchmark/benchmark.h>
 #include "GreekCore/Pricing/MonteCarlo.h"
 #include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Pricing/StreamingPayOff.h"
+#include "GreekCore/Pricing/Heston.h"
+#include "GreekCore/Pricing/Barrier.h"
+#include "GreekCore/Pricing/ControlVariate.h"
+#include "GreekCore/Numerics/VectorMath.h"
 #include "GreekCore/Rates/InterpolatorStrategy.h"
+#include <algorithm>
 #include <vector>
 #include <span>
+#include <cmath>
 
 using namespace GreekCore;
 
@@ -32,6 +39,273 @@ static void BM_MonteCarlo_Call(benchmark::State& state) {
 // Range: 1k to 1M paths
 BENCHMARK(BM_MonteCarlo_Call)->Range(1024, 1024 * 1024);
 
+// Full Greek set of an Asian option: one pass over the draws vs one simulation per bumped market
+static void BM_MonteCarlo_AsianGreeks(benchmark::State& state) {
+    PayOffAsian payoff(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.greeks = state.range(0) ? GreeksMode::SinglePass : GreeksMode::Repricing;
+    const size_t paths = 16384;
+
+    for (auto _ : state) {
+        auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, paths, 64, payoff, settings);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetLabel(state.range(0) ? "SinglePass" : "Repricing");
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_AsianGreeks)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Daily-fixing Asian: full path vector (Arg 0) vs streaming running sum (Arg 1).
+static void BM_MonteCarlo_StreamingAsian(benchmark::State& state) {
+    MonteCarloSettings settings;
+    settings.greeks = GreeksMode::Repricing;
+    const size_t paths = 16384;
+
+    for (auto _ : state) {
+        auto result = state.range(0)
+            ? MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, paths, 252, StreamingAsian(OptionType::Call, 100.0), settings)
+            : MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, paths, 252, PayOffAsian(OptionType::Call, 100.0), settings);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetLabel(state.range(0) ? "Streaming" : "Vector");
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_StreamingAsian)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Scalar path loop (Arg 0) vs structure-of-arrays blocks of Arg paths (MonteCarloSettings::path_block).
+static void BM_MonteCarlo_PathBlocks(benchmark::State& state) {
+    StreamingAsian payoff(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.path_block = static_cast<size_t>(state.range(0));
+    const size_t paths = 16384;
+
+    for (auto _ : state) {
+        auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, paths, 252, payoff, settings);
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_PathBlocks)->Arg(0)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+// Many small asynchronous pricings: Arg 0 = one std::async thread per call (the previous
+// implementation), 1 = ThreadPool::global() tasks.
+static void BM_MonteCarlo_AsyncSmallJobs(benchmark::State& state) {
+    PayOffVanilla call(OptionType::Call, 100.0);
+    const bool pooled = state.range(0) != 0;
+    const size_t jobs = 64, paths = 256;
+    std::vector<StatisticsMean> gatherers(jobs);
+    std::vector<std::future<void>> futures(jobs);
+
+    for (auto _ : state) {
+        for (size_t j = 0; j < jobs; ++j) {
+            StatisticsMean& gatherer = gatherers[j];
+            futures[j] = pooled
+                ? MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, paths, call, gatherer)
+                : std::async(std::launch::async, [&]() {
+                      MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, paths, call, gatherer);
+                  });
+        }
+        for (auto& f : futures) f.get();
+    }
+    state.counters["Jobs"] = benchmark::Counter(state.iterations() * jobs, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_AsyncSmallJobs)->Arg(0)->Arg(1)->UseRealTime()->Unit(benchmark::kMicrosecond);
+
+// 50-strike call chain: Arg 0 = one priceEuropean per strike, 1 = one pricePortfolio run.
+static void BM_MonteCarlo_OptionChain(benchmark::State& state) {
+    const size_t paths = 100000;
+    std::vector<PayOffVanilla> chain;
+    for (int i = 0; i < 50; ++i) chain.emplace_back(OptionType::Call, 75.0 + i);
+    MonteCarloSettings settings;
+
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            for (const auto& payoff : chain) {
+                benchmark::DoNotOptimize(MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, paths, payoff, settings));
+            }
+        } else {
+            benchmark::DoNotOptimize(MonteCarloPricer::pricePortfolio(100.0, 0.05, 0.2, 1.0, paths, settings, chain));
+        }
+    }
+    state.counters["Options"] = benchmark::Counter(state.iterations() * chain.size(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_OptionChain)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Heston QE accuracy per unit of time: Arg = QE steps per year. The counters compare the price
+// with the semi-analytic reference: Error = |MC - reference|, StdErr the Monte Carlo standard error.
+static void BM_MonteCarlo_HestonQE(benchmark::State& state) {
+    const HestonParameters heston{0.0175, 1.5768, 0.0398, 0.5751, -0.5711};
+    const double reference = hestonPrice(OptionType::Call, 100.0, 100.0, 0.0, 1.0, heston);
+    PayOffVanilla call(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.max_time_step = 1.0 / static_cast<double>(state.range(0));
+    const size_t paths = 100000;
+
+    MonteCarloRunResult result{};
+    for (auto _ : state) {
+        result = MonteCarloPricer::priceHeston(100.0, 0.0, heston, 1.0, paths, call, settings);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["Error"] = std::abs(result.price - reference);
+    state.counters["StdErr"] = result.error_estimate;
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_HestonQE)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMillisecond);
+
+// Equally weighted basket call on Arg assets (correlation 0.5), one step.
+static void BM_MonteCarlo_Basket(benchmark::State& state) {
+    const size_t assets = static_cast<size_t>(state.range(0));
+    const size_t paths = 100000;
+    MultiAssetMarket market{std::vector<double>(assets, 100.0), Parameters(0.03),
+                            std::vector<Parameters>(assets, Parameters(0.2)), std::vector<double>(assets * assets, 0.5)};
+    for (size_t a = 0; a < assets; ++a) market.correlation[a * assets + a] = 1.0;
+    PayOffBasket basket(OptionType::Call, std::vector<double>(assets, 1.0 / assets), 100.0);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MonteCarloPricer::priceMultiAsset(market, 1.0, paths, basket));
+    }
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_Basket)->Arg(2)->Arg(8)->Arg(32)->Unit(benchmark::kMillisecond);
+
+// Longstaff-Schwartz American put, 50 exercise dates: Arg 0 stores the regression path matrix,
+// Arg 1 regenerates the paths at every date (memory budget mode).
+static void BM_MonteCarlo_LSM(benchmark::State& state) {
+    PayOffVanilla put(OptionType::Put, 40.0);
+    EarlyExerciseSettings lsm;
+    if (state.range(0) == 1) lsm.memory_budget = 1;
+    const size_t paths = 50000;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(MonteCarloPricer::priceAmerican(36.0, 0.06, 0.2, 1.0, 50, paths, put, lsm));
+    }
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MonteCarlo_LSM)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Up-and-out call (S0 = K = 100, H = 120): error against continuous monitoring, in basis points
+// of the spot, for Arg 1 time steps. Arg 0 = 0 checks the barrier at the dates only, 1 applies the
+// Brownian-bridge crossing correction. Sobol paths keep the Monte Carlo noise well below 1bp.
+static void BM_MonteCarlo_BarrierSteps(benchmark::State& state) {
+    const bool bridge = state.range(0) == 1;
+    const size_t steps = static_cast<size_t>(state.range(1));
+    const Parameters sigma(0.2);
+    const double reference = barrierPrice(OptionType::Call, BarrierType::UpAndOut, 100.0, 100.0, 120.0, 0.05, 0.2, 1.0);
+    MonteCarloSettings settings;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    settings.path_block = 256;
+    const size_t paths = 1 << 16;
+
+    MonteCarloResult result{};
+    for (auto _ : state) {
+        if (bridge) {
+            result = MonteCarloPricer::pricePathDependent(100.0, 0.05, sigma, 1.0, paths, steps,
+                StreamingBridgeBarrier(BarrierType::UpAndOut, 120.0, OptionType::Call, 100.0), settings);
+        } else {
+            result = MonteCarloPricer::pricePathDependent(100.0, 0.05, sigma, 1.0, paths, steps,
+                StreamingBarrier(BarrierType::UpAndOut, 120.0, OptionType::Call, 100.0), settings);
+        }
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["ErrorBp"] = std::abs(result.price - reference) * 100.0;
+}
+BENCHMARK(BM_MonteCarlo_BarrierSteps)
+    ->Args({0, 4})->Args({0, 13})->Args({0, 52})->Args({0, 252})->Args({0, 1008})
+    ->Args({1, 4})->Args({1, 13})->Args({1, 52})
+    ->Unit(benchmark::kMillisecond);
+
+// Continuously averaged geometric Asian call to an RMSE of 0.05. Arg 0: single level with 256
+// steps (bias below 0.05 / sqrt(2)) and enough paths for the statistical half of the error budget;
+// Arg 1: multilevel driver from 2 steps. Error = |price - continuous-average reference|.
+static void BM_MonteCarlo_Multilevel(benchmark::State& state) {
+    const double rmse = 0.05;
+    const double reference = geometricAsianPrice(OptionType::Call, 100.0, 100.0, 0.05, 0.3, 1.0, 1 << 16);
+    PayOffGeometricAsian asian(OptionType::Call, 100.0);
+    double price = 0.0;
+    for (auto _ : state) {
+        if (state.range(0) == 0) {
+            const size_t paths = static_cast<size_t>(2.0 * 280.0 / (rmse * rmse)); // payoff variance ~ 280
+            price = MonteCarloPricer::pricePortfolio(100.0, 0.05, 0.3, TimeGrid(1.0, 256), paths, MonteCarloSettings{}, asian).price[0];
+        } else {
+            MultilevelSettings mlmc;
+            mlmc.target_rmse = rmse;
+            mlmc.base_steps = 2;
+            price = MonteCarloPricer::priceMultilevel(100.0, 0.05, 0.3, 1.0, asian, mlmc).price;
+        }
+        benchmark::DoNotOptimize(price);
+    }
+    state.counters["Error"] = std::abs(price - reference);
+}
+BENCHMARK(BM_MonteCarlo_Multilevel)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Digital call struck Arg 0 (200 or 250: 3.5 / 4.6 standard deviations out of the money) with
+// 100k paths; Arg 1 = 0 plain sampling, 1 automatic drift shift. RelErr = StdErr / price.
+static void BM_MonteCarlo_ImportanceSampling(benchmark::State& state) {
+    PayOffDigital digital(OptionType::Call, static_cast<double>(state.range(0)));
+    MonteCarloSettings settings;
+    settings.importance_sampling.automatic = state.range(1) != 0;
+    MonteCarloResult result{};
+    for (auto _ : state) {
+        result = MonteCarloPricer::priceEuropean(100.0, 0.02, 0.2, 1.0, 100000, digital, settings);
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["Price"] = result.price;
+    state.counters["StdErr"] = result.error_estimate;
+    state.counters["RelErr"] = result.price > 0.0 ? result.error_estimate / result.price : 0.0;
+}
+BENCHMARK(BM_MonteCarlo_ImportanceSampling)->Args({200, 0})->Args({200, 1})->Args({250, 0})->Args({250, 1})->Unit(benchmark::kMillisecond);
+
+// Path kernels per precision: normals for 1024 paths x 252 steps, then one lognormalStep per
+// step on the SoA spots. MaxRelErr: largest relative deviation of the terminal spots from the
+// same normals stepped in double.
+template<typename Real>
+static void BM_PathKernels(benchmark::State& state) {
+    const size_t block = 1024, steps = 252;
+    NormalBatchGenerator normals(Xoshiro256(7));
+    std::vector<Real> z(block * steps), spot(block);
+    const Real drift = static_cast<Real>(0.05 / 252 - 0.5 * 0.04 / 252), diff = static_cast<Real>(0.2 / std::sqrt(252.0));
+
+    for (auto _ : state) {
+        normals.fill(std::span<Real>(z));
+        std::fill(spot.begin(), spot.end(), Real(100));
+        for (size_t j = 0; j < steps; ++j) lognormalStep(std::span<Real>(spot), std::span<const Real>(z.data() + j * block, block), drift, diff);
+        benchmark::DoNotOptimize(spot.data());
+    }
+
+    std::vector<double> z_ref(z.begin(), z.end()), spot_ref(block, 100.0);
+    for (size_t j = 0; j < steps; ++j) lognormalStep(std::span<double>(spot_ref), std::span<const double>(z_ref.data() + j * block, block), drift, diff);
+    double max_error = 0.0;
+    for (size_t k = 0; k < block; ++k) max_error = std::max(max_error, std::abs(spot[k] - spot_ref[k]) / spot_ref[k]);
+    state.counters["Steps"] = benchmark::Counter(state.iterations() * block * steps, benchmark::Counter::kIsRate);
+    state.counters["MaxRelErr"] = max_error;
+}
+BENCHMARK_TEMPLATE(BM_PathKernels, double)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_PathKernels, float)->Unit(benchmark::kMicrosecond);
+
+// Daily-fixing Asian call on 1024-path blocks: Arg 0 = double, 1 = float paths. Quasi-random
+// sampling gives both the same normals, so Error = |price - double price| is the precision error.
+static void BM_MonteCarlo_PathPrecision(benchmark::State& state) {
+    StreamingAsian payoff(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.path_block = 1024;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    const size_t paths = 16384;
+    const double reference = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, paths, 252, payoff, settings).price;
+    settings.precision = state.range(0) != 0 ? Precision::Float : Precision::Double;
+
+    double price = 0.0;
+    for (auto _ : state) {
+        price = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, paths, 252, payoff, settings).price;
+        benchmark::DoNotOptimize(price);
+    }
+    state.counters["Paths"] = benchmark::Counter(state.iterations() * paths, benchmark::Counter::kIsRate);
+    state.counters["Error"] = std::abs(price - reference);
+}
+BENCHMARK(BM_MonteCarlo_PathPrecision)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
 static void BM_Interpolation(benchmark::State& state) {
     // Setup curve
     std::vector<double> times;
@@ -5,6 +5,7 @@
 #include <vector>
 #include <cmath>
 #include <iomanip>
+#include <stop_token>
 #include "GreekCore/Pricing/MonteCarlo.h"
 #include "GreekCore/Pricing/PayOff.h"
 #include "GreekCore/Numerics/Statistics.h"
@@ -66,5 +67,24 @@ int main() {
     std::cout << "\n--- Final Result ---" << std::endl;
     std::cout << "Call Price: " << finalPrice << std::endl;
 
+    // 2. Cancellation: a market update makes a running re-price stale, so drop it.
+    std::cout << "\n[Main] Launching a cancellable re-price (deadline in 2s)..." << std::endl;
+    std::stop_source stopSource;
+    StatisticsMean repriceGatherer;
+    auto repriceFuture = MonteCarloPricer::priceEuropeanAsync(
+        S0, r, sigma, T, 10 * paths, callPayoff, repriceGatherer, stopSource.get_token(),
+        std::chrono::steady_clock::now() + std::chrono::seconds(2)
+    );
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    std::cout << "[Main] Market moved: cancelling the stale re-price." << std::endl;
+    stopSource.request_stop();
+
+    MonteCarloRunResult partial = repriceFuture.get();
+    std::cout << "Partial Price: " << partial.price << " +/- " << partial.error_estimate
+              << " from " << partial.paths << " paths ("
+              << (partial.stop_reason == StopReason::Cancelled ? "cancelled" :
+                  partial.stop_reason == StopReason::Deadline ? "timed out" : "completed") << ")" << std::endl;
+
     return 0;
 }
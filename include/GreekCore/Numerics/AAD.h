@@ -0,0 +1,243 @@
+#ifndef GREEKCORE_AAD_H
+#define GREEKCORE_AAD_H
+
+/**
+ * @file AAD.h
+ * @brief Tape-based reverse-mode automatic differentiation (AAD).
+ *
+ * A Number carries a value and the index of the tape node that produced it. Every operation
+ * on Numbers records one node holding the local partial derivatives with respect to (at most
+ * two) arguments; a reverse sweep over the tape then accumulates the adjoints
+ * $\bar{x} = \partial y / \partial x$ of every input at a small constant multiple of the cost
+ * of computing y. Plain doubles mixed into expressions are constants and are never recorded.
+ *
+ * Checkpointing: inputs and per-simulation setup are recorded first, then a mark is set.
+ * Each path records its own nodes, propagates back to the mark and rewinds, so the tape never
+ * grows with the number of paths; the adjoints of the nodes before the mark keep accumulating
+ * and are propagated to the inputs once at the end (propagateMarkToStart()). A calculation
+ * nested in a larger recording saves size() and markPosition() on entry, checkpoints and
+ * propagates relative to that size, then rewinds to it and restores the mark.
+ *
+ * @cite Savine, A. (2018). "Modern Computational Finance: AAD and Parallel Simulations". Wiley.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "GreekCore/Utils/CompilerMacros.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief Recording of the operations of an AAD calculation.
+     *
+     * Nodes live in an arena of fixed-size blocks: recording never moves existing nodes and
+     * rewinding keeps the blocks for reuse, so steady-state recording does not allocate.
+     * Each thread records on its own tape (Tape::local()).
+     */
+    class Tape {
+    public:
+        /// Index of "no node": the value is a constant.
+        static constexpr size_t kConstant = std::numeric_limits<size_t>::max();
+
+        struct Node {
+            double adjoint;
+            double partial[2];
+            size_t arg[2];
+            uint32_t n_args;
+        };
+
+        /**
+         * @return The tape of the calling thread, used by all Number operations.
+         */
+        static Tape& local() {
+            thread_local Tape tape;
+            return tape;
+        }
+
+        size_t size() const { return m_size; }
+
+        FORCE_INLINE Node& node(size_t index) {
+            return m_blocks[index >> kBlockBits][index & (kBlockSize - 1)];
+        }
+
+        /// Records a node without arguments (an input).
+        FORCE_INLINE size_t recordLeaf() {
+            Node& n = push();
+            n.n_args = 0;
+            return m_size - 1;
+        }
+
+        /// Records the result of a unary operation; constants are skipped.
+        FORCE_INLINE size_t record(size_t a, double da) {
+            if (a == kConstant) return kConstant;
+            Node& n = push();
+            n.n_args = 1;
+            n.arg[0] = a;
+            n.partial[0] = da;
+            return m_size - 1;
+        }
+
+        /// Records the result of a binary operation; constant arguments are skipped.
+        FORCE_INLINE size_t record(size_t a, double da, size_t b, double db) {
+            if (a == kConstant) return record(b, db);
+            if (b == kConstant) return record(a, da);
+            Node& n = push();
+            n.n_args = 2;
+            n.arg[0] = a;
+            n.partial[0] = da;
+            n.arg[1] = b;
+            n.partial[1] = db;
+            return m_size - 1;
+        }
+
+        /// Sets the checkpoint used by propagateToMark() / rewindToMark().
+        void mark() { m_mark = m_size; }
+
+        /// Sets the checkpoint to a position saved with markPosition().
+        void mark(size_t position) { m_mark = position; }
+
+        size_t markPosition() const { return m_mark; }
+
+        /// Drops every node recorded after the mark (their storage is kept).
+        void rewindToMark() { m_size = m_mark; }
+
+        /// Drops every node at or after `position`.
+        void rewind(size_t position) { m_size = position; }
+
+        /// Drops every node and the mark.
+        void clear() { m_size = 0; m_mark = 0; }
+
+        /// Sets all adjoints to zero.
+        void resetAdjoints();
+
+        /// Reverse sweep over the nodes in [begin, end), from the last to the first.
+        void propagate(size_t begin, size_t end);
+
+        /// Reverse sweep from the last node down to the mark.
+        void propagateToMark() { propagate(m_mark, m_size); }
+
+        /// Reverse sweep from the mark down to the first node.
+        void propagateMarkToStart() { propagate(0, m_mark); }
+
+    private:
+        static constexpr size_t kBlockBits = 14;
+        static constexpr size_t kBlockSize = size_t{1} << kBlockBits;
+
+        std::vector<std::unique_ptr<Node[]>> m_blocks;
+        size_t m_size = 0;
+        size_t m_mark = 0;
+
+        FORCE_INLINE Node& push() {
+            if ((m_size >> kBlockBits) == m_blocks.size()) [[unlikely]] {
+                m_blocks.push_back(std::make_unique<Node[]>(kBlockSize));
+            }
+            Node& n = node(m_size++);
+            n.adjoint = 0.0;
+            return n;
+        }
+    };
+
+    /**
+     * @brief Active number for reverse-mode AD, recorded on Tape::local().
+     *
+     * Construction from a double gives a constant; use Number::input() (or putOnTape()) for
+     * the variables whose adjoints are wanted. Comparisons act on values, so control flow
+     * follows the recorded path (payoff kinks are differentiated as their one-sided slope).
+     */
+    class Number {
+    public:
+        Number() : m_value(0.0), m_node(Tape::kConstant) {}
+        Number(double value) : m_value(value), m_node(Tape::kConstant) {}
+
+        /// A new input variable on the calling thread's tape.
+        static Number input(double value) {
+            Number x(value);
+            x.putOnTape();
+            return x;
+        }
+
+        void putOnTape() { m_node = Tape::local().recordLeaf(); }
+
+        double value() const { return m_value; }
+        size_t node() const { return m_node; }
+        bool isConstant() const { return m_node == Tape::kConstant; }
+
+        /**
+         * @brief Adjoint of this number on the calling thread's tape (zero for constants).
+         */
+        double adjoint() const { return isConstant() ? 0.0 : Tape::local().node(m_node).adjoint; }
+
+        /**
+         * @brief Seeds the adjoint before a reverse sweep (ignored for constants).
+         */
+        void setAdjoint(double adjoint) const {
+            if (!isConstant()) Tape::local().node(m_node).adjoint = adjoint;
+        }
+
+        /// Builds a Number from a value and an already recorded node.
+        static Number fromNode(double value, size_t node) {
+            Number x(value);
+            x.m_node = node;
+            return x;
+        }
+
+        Number& operator+=(const Number& rhs) { return *this = *this + rhs; }
+        Number& operator-=(const Number& rhs) { return *this = *this - rhs; }
+        Number& operator*=(const Number& rhs) { return *this = *this * rhs; }
+        Number& operator/=(const Number& rhs) { return *this = *this / rhs; }
+
+        friend FORCE_INLINE Number operator+(const Number& a, const Number& b) {
+            return fromNode(a.m_value + b.m_value, Tape::local().record(a.m_node, 1.0, b.m_node, 1.0));
+        }
+        friend FORCE_INLINE Number operator-(const Number& a, const Number& b) {
+            return fromNode(a.m_value - b.m_value, Tape::local().record(a.m_node, 1.0, b.m_node, -1.0));
+        }
+        friend FORCE_INLINE Number operator*(const Number& a, const Number& b) {
+            return fromNode(a.m_value * b.m_value, Tape::local().record(a.m_node, b.m_value, b.m_node, a.m_value));
+        }
+        friend FORCE_INLINE Number operator/(const Number& a, const Number& b) {
+            const double inv = 1.0 / b.m_value;
+            const double result = a.m_value * inv;
+            return fromNode(result, Tape::local().record(a.m_node, inv, b.m_node, -result * inv));
+        }
+        friend FORCE_INLINE Number operator-(const Number& a) {
+            return fromNode(-a.m_value, Tape::local().record(a.m_node, -1.0));
+        }
+
+        friend bool operator<(const Number& a, const Number& b) { return a.m_value < b.m_value; }
+        friend bool operator>(const Number& a, const Number& b) { return a.m_value > b.m_value; }
+        friend bool operator<=(const Number& a, const Number& b) { return a.m_value <= b.m_value; }
+        friend bool operator>=(const Number& a, const Number& b) { return a.m_value >= b.m_value; }
+
+        friend FORCE_INLINE Number exp(const Number& a) {
+            const double e = std::exp(a.m_value);
+            return fromNode(e, Tape::local().record(a.m_node, e));
+        }
+        friend FORCE_INLINE Number log(const Number& a) {
+            return fromNode(std::log(a.m_value), Tape::local().record(a.m_node, 1.0 / a.m_value));
+        }
+        friend FORCE_INLINE Number sqrt(const Number& a) {
+            const double s = std::sqrt(a.m_value);
+            return fromNode(s, Tape::local().record(a.m_node, s > 0.0 ? 0.5 / s : 0.0));
+        }
+        friend FORCE_INLINE Number abs(const Number& a) {
+            return a.m_value < 0.0 ? -a : a;
+        }
+        friend FORCE_INLINE Number max(const Number& a, const Number& b) {
+            return a.m_value >= b.m_value ? a : b;
+        }
+        friend FORCE_INLINE Number min(const Number& a, const Number& b) {
+            return a.m_value <= b.m_value ? a : b;
+        }
+
+    private:
+        double m_value;
+        size_t m_node;
+    };
+
+}
+#endif // GREEKCORE_AAD_H
@@ -89,6 +89,14 @@ namespace GreekCore {
                     b += std::copysign(tol, m); 
                 }
                 fb = f(b);
+
+                // Keep the root bracketed by [b, c]
+                if ((fb > 0.0) == (fc > 0.0)) {
+                    c = a;
+                    fc = fa;
+                    d = b - a;
+                    e = d;
+                }
             }
             return b;
         }
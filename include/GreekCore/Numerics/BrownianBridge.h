@@ -0,0 +1,56 @@
+#ifndef GREEKCORE_BROWNIANBRIDGE_H
+#define GREEKCORE_BROWNIANBRIDGE_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace GreekCore {
+
+    /**
+     * @brief Brownian-bridge construction of a Brownian path on a (possibly non-uniform) grid.
+     *
+     * The first normal fixes the terminal value W(t_n), the second the midpoint, and so on by
+     * bisection, so the leading normals carry most of the path variance. Combined with a
+     * low-discrepancy sequence this puts the best-distributed coordinates on the most important
+     * directions of the path.
+     *
+     * The output is the standardized increments $(W(t_j) - W(t_{j-1})) / \sqrt{t_j - t_{j-1}}$,
+     * which are again i.i.d. N(0,1). They can therefore replace the per-step normals of a path
+     * simulation unchanged.
+     *
+     * @cite Jäckel, P. (2002). "Monte Carlo Methods in Finance". Wiley. Chapter 10.
+     */
+    class BrownianBridge {
+    public:
+        /**
+         * @param times Strictly increasing observation times $t_1 < \dots < t_n$ (with $t_0 = 0$).
+         * @throws std::invalid_argument If the grid is empty or not increasing.
+         */
+        explicit BrownianBridge(std::span<const double> times);
+
+        /**
+         * @brief Uniform grid $t_j = j / steps$.
+         */
+        explicit BrownianBridge(size_t steps);
+
+        size_t size() const { return m_size; }
+
+        /**
+         * @brief Maps i.i.d. normals (most important first) to standardized path increments.
+         * @param z Input normals, size().
+         * @param out Output increments, size(). May not alias `z`.
+         */
+        void transform(std::span<const double> z, std::span<double> out) const;
+
+    private:
+        size_t m_size;
+        std::vector<size_t> m_bridgeIndex, m_leftIndex, m_rightIndex;
+        std::vector<double> m_leftWeight, m_rightWeight, m_stdDev;
+        std::vector<double> m_invSqrtDt;
+
+        void initialize(std::span<const double> times);
+    };
+
+}
+#endif // GREEKCORE_BROWNIANBRIDGE_H
@@ -0,0 +1,45 @@
+#ifndef GREEKCORE_CHOLESKY_H
+#define GREEKCORE_CHOLESKY_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace GreekCore {
+
+    /**
+     * @brief Cholesky factor $L$ of a symmetric positive definite matrix $C = L L^T$
+     * (typically a correlation matrix), used to correlate independent normals: $x = L z$.
+     */
+    class CholeskyFactor {
+    public:
+        /**
+         * @param matrix Row-major n x n symmetric matrix (only the lower triangle is read).
+         * @throws std::invalid_argument If matrix.size() != n * n or the matrix is not positive definite.
+         */
+        CholeskyFactor(std::span<const double> matrix, size_t n);
+
+        size_t size() const { return m_n; }
+
+        /// Entry (i, j) of L (0 above the diagonal).
+        double operator()(size_t i, size_t j) const { return j <= i ? m_lower[i * m_n + j] : 0.0; }
+
+        /**
+         * @brief x = L z for one vector (z.size() == x.size() == size()).
+         */
+        void multiply(std::span<const double> z, std::span<double> x) const;
+
+        /**
+         * @brief x = L z for a block of vectors stored factor-major (structure of arrays):
+         * component i of vector p is at [i * block + p]. Runs on the widest available
+         * instruction set (see lowerTriangularMultiply() in VectorMath.h).
+         */
+        void multiplyBlock(std::span<const double> z, std::span<double> x, size_t block) const;
+
+    private:
+        size_t m_n;
+        std::vector<double> m_lower; // row-major, zeros above the diagonal
+    };
+
+}
+#endif // GREEKCORE_CHOLESKY_H
@@ -0,0 +1,160 @@
+#ifndef GREEKCORE_DISTRIBUTIONSTATISTICS_H
+#define GREEKCORE_DISTRIBUTIONSTATISTICS_H
+
+/**
+ * @file DistributionStatistics.h
+ * @brief Fixed-memory gatherers for quantiles and tail risk of simulated distributions (e.g. P&L).
+ *
+ * All gatherers satisfy StatisticsGatherer and MergeableGatherer and keep O(1) memory in the
+ * number of results. Row 0 of getResultsSoFar() is [Mean, StdErr] like the other gatherers;
+ * the following rows are gatherer specific (see each class).
+ *
+ * Sign convention: results are P&L, so losses are negative. Value at Risk and Expected
+ * Shortfall at confidence level $\alpha$ are reported as positive losses:
+ * $VaR_\alpha = -q_{1-\alpha}$ and $ES_\alpha = -E[X \mid X \le q_{1-\alpha}]$.
+ */
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "GreekCore/Numerics/Statistics.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief P-square streaming estimator of one quantile (five markers, no sample storage).
+     *
+     * @cite Jain, R. & Chlamtac, I. (1985). "The P² algorithm for dynamic calculation of
+     *       quantiles and histograms without storing observations". CACM 28(10).
+     */
+    class P2Quantile {
+    public:
+        explicit P2Quantile(double probability);
+
+        void add(double x);
+
+        /**
+         * @brief Combines the marker sets (approximate: the merged markers interpolate the two
+         * piecewise-linear CDFs described by the markers; exact while either side has < 5 results).
+         */
+        void merge(const P2Quantile& other);
+
+        double probability() const { return m_p; }
+        uint64_t count() const { return m_count; }
+
+        /// Current estimate (0 before the first result).
+        double value() const;
+
+    private:
+        double m_p;
+        uint64_t m_count = 0;
+        std::array<double, 5> m_height{};   // marker heights q_i (first results while m_count < 5)
+        std::array<double, 5> m_position{}; // actual 0-based marker positions n_i
+        std::array<double, 5> m_desired{};  // desired positions n'_i
+        std::array<double, 5> m_increment;  // desired position increments dn'_i
+
+        double rank(double x) const; // interpolated 0-based rank of x (m_count >= 5)
+    };
+
+    /**
+     * @brief Streaming quantile gatherer: one P2Quantile per requested probability.
+     *
+     * getResultsSoFar(): row 0 [Mean, StdErr], then [p, quantile] per probability.
+     */
+    class StatisticsP2Quantile {
+    public:
+        explicit StatisticsP2Quantile(const std::vector<double>& probabilities);
+
+        void dumpOneResult(double result);
+        std::vector<std::vector<double>> getResultsSoFar() const;
+        void snapshot(GathererSnapshot& out) const { m_moments.snapshot(out); }
+        void merge(const StatisticsP2Quantile& other);
+
+        /// Estimate of the i-th requested quantile.
+        double quantile(size_t i) const { return m_quantiles[i].value(); }
+
+    private:
+        std::vector<P2Quantile> m_quantiles;
+        WelfordState m_moments;
+    };
+
+    /**
+     * @brief Fixed-memory histogram with logarithmic buckets on both signs.
+     *
+     * Magnitudes in [min_magnitude, max_magnitude) are split into `buckets_per_decade` buckets per
+     * power of ten (relative width 10^(1/buckets_per_decade) - 1, e.g. 2.3% for 100), mirrored
+     * for negative results; |x| < min_magnitude falls in a central bucket and |x| >= max_magnitude
+     * in one overflow bucket per sign. Each bucket keeps its count and sum, so merges are exact
+     * and tail expectations use the bucket means.
+     *
+     * getResultsSoFar(): row 0 [Mean, StdErr], then [lower, upper, count] per non-empty bucket.
+     */
+    class StatisticsHistogram {
+    public:
+        StatisticsHistogram(double min_magnitude, double max_magnitude, size_t buckets_per_decade = 100);
+
+        void dumpOneResult(double result);
+        std::vector<std::vector<double>> getResultsSoFar() const;
+        void snapshot(GathererSnapshot& out) const { m_moments.snapshot(out); }
+
+        /// Adds the counts of `other`, which must have the same bucket layout.
+        void merge(const StatisticsHistogram& other);
+
+        uint64_t count() const { return m_moments.count; }
+
+        /// Quantile at probability p, interpolated linearly inside its bucket.
+        double quantile(double p) const;
+
+        /// $E[X \mid X \le q_p]$: mean of the lowest fraction p of the results.
+        double lowerTailMean(double p) const;
+
+        double valueAtRisk(double confidence) const { return -quantile(1.0 - confidence); }
+        double expectedShortfall(double confidence) const { return -lowerTailMean(1.0 - confidence); }
+
+        size_t bucketCount() const { return m_counts.size(); }
+        double bucketLower(size_t i) const;
+        double bucketUpper(size_t i) const;
+
+    private:
+        double m_min_magnitude;
+        double m_max_magnitude;
+        size_t m_buckets_per_decade;
+        size_t m_side; // log buckets per sign
+        std::vector<uint64_t> m_counts;
+        std::vector<double> m_sums;
+        WelfordState m_moments;
+        double m_min;
+        double m_max;
+
+        size_t bucketOf(double x) const;
+        double edge(size_t k) const; // lower magnitude of log bucket k (k == m_side: max_magnitude)
+    };
+
+    /**
+     * @brief Value at Risk and Expected Shortfall at chosen confidence levels, from a
+     * StatisticsHistogram (fixed memory, exactly mergeable, accurate to the bucket width).
+     *
+     * getResultsSoFar(): row 0 [Mean, StdErr], then [confidence, VaR, ES] per level.
+     */
+    class StatisticsExpectedShortfall {
+    public:
+        StatisticsExpectedShortfall(const std::vector<double>& confidence_levels,
+                                    double min_magnitude = 1e-6, double max_magnitude = 1e12,
+                                    size_t buckets_per_decade = 200);
+
+        void dumpOneResult(double result) { m_histogram.dumpOneResult(result); }
+        std::vector<std::vector<double>> getResultsSoFar() const;
+        void snapshot(GathererSnapshot& out) const { m_histogram.snapshot(out); }
+        void merge(const StatisticsExpectedShortfall& other) { m_histogram.merge(other.m_histogram); }
+
+        double valueAtRisk(size_t i) const { return m_histogram.valueAtRisk(m_levels[i]); }
+        double expectedShortfall(size_t i) const { return m_histogram.expectedShortfall(m_levels[i]); }
+        const StatisticsHistogram& histogram() const { return m_histogram; }
+
+    private:
+        std::vector<double> m_levels;
+        StatisticsHistogram m_histogram;
+    };
+
+}
+#endif // GREEKCORE_DISTRIBUTIONSTATISTICS_H
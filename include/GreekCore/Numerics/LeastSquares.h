@@ -0,0 +1,63 @@
+#ifndef GREEKCORE_LEASTSQUARES_H
+#define GREEKCORE_LEASTSQUARES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GreekCore {
+
+    /**
+     * @brief Families of regression functions $\phi_0(x), \dots, \phi_{k-1}(x)$.
+     */
+    enum class RegressionBasis {
+        Polynomial, ///< Monomials $1, x, x^2, \dots$
+        Laguerre    ///< Weighted Laguerre polynomials $e^{-x/2} L_k(x)$ (Longstaff & Schwartz 2001).
+    };
+
+    /**
+     * @brief Evaluates the first out.size() functions of `basis` at x.
+     */
+    void evaluateBasis(RegressionBasis basis, double x, std::span<double> out);
+
+    /**
+     * @brief Streaming linear least squares $\min_\beta \sum_i (y_i - \beta \cdot \phi_i)^2$
+     * for a handful of regressors, through the normal equations.
+     *
+     * Only $\Phi^T \Phi$ and $\Phi^T y$ are kept, so the observations can be added in any
+     * number of passes and the partial systems of parallel batches merged (in a fixed order
+     * for reproducible sums). The regressors should be scaled to O(1) to keep the normal
+     * equations well conditioned.
+     */
+    class LeastSquares {
+    public:
+        explicit LeastSquares(size_t regressors = 0);
+
+        size_t regressors() const { return m_k; }
+        uint64_t count() const { return m_count; }
+
+        /// Adds one observation; phi.size() == regressors().
+        void add(std::span<const double> phi, double y);
+
+        /// Adds the observations of `other`, which must have the same number of regressors.
+        void merge(const LeastSquares& other);
+
+        /**
+         * @brief Coefficients $\beta$ by Cholesky factorization of the normal equations.
+         *
+         * Regressors that are (numerically) linear combinations of earlier ones, e.g. when
+         * there are fewer observations than regressors, get a zero coefficient instead of
+         * making the solve fail; with no observations all coefficients are 0.
+         */
+        std::vector<double> solve() const;
+
+    private:
+        size_t m_k;
+        uint64_t m_count = 0;
+        std::vector<double> m_gram; // Phi^T Phi, row-major k x k (lower triangle used)
+        std::vector<double> m_rhs;  // Phi^T y
+    };
+
+}
+#endif // GREEKCORE_LEASTSQUARES_H
@@ -31,6 +31,19 @@ namespace GreekCore {
         explicit Xoshiro256(uint64_t seed);
         result_type operator()();
 
+        /**
+         * @brief Advances the state by 2^128 steps.
+         * Calling jump() k times yields k non-overlapping subsequences of length 2^128,
+         * suitable for handing one stream to each parallel worker.
+         */
+        void jump();
+
+        /**
+         * @brief Advances the state by 2^192 steps.
+         * Generates 2^64 starting points, each of which can in turn be split with jump().
+         */
+        void long_jump();
+
         /**
          * @brief Converts uint64_t to double in [0, 1) range.
          * Uses bit manipulation of IEEE 754 representation.
@@ -40,5 +53,30 @@ namespace GreekCore {
             return (x >> 11) * 0x1.0p-53;
         }
     };
+
+    /**
+     * @brief Hands out provably disjoint Xoshiro256 streams for parallel work.
+     *
+     * Stream k is the root generator advanced by k * 2^128 steps, i.e. exactly what calling
+     * jump() k times would give, so streams never overlap for k < 2^64. The jump is a linear
+     * map over GF(2); its powers J^(2^i) are tabulated once per process so that any stream
+     * is reached in O(log k) matrix-vector products instead of k sequential jumps.
+     *
+     * Typical use: one factory per simulation, stream(k) for the k-th batch of paths,
+     * Greeks scenario or portfolio trade.
+     */
+    class StreamFactory {
+        Xoshiro256 m_root;
+    public:
+        explicit StreamFactory(uint64_t seed) : m_root(seed) {}
+        explicit StreamFactory(const Xoshiro256& root) : m_root(root) {}
+
+        /**
+         * @brief Returns the k-th stream (root jumped k times).
+         */
+        [[nodiscard]] Xoshiro256 stream(uint64_t k) const;
+
+        const Xoshiro256& root() const { return m_root; }
+    };
 }
 #endif // GREEKCORE_RNG_H
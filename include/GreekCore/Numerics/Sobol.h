@@ -0,0 +1,75 @@
+#ifndef GREEKCORE_SOBOL_H
+#define GREEKCORE_SOBOL_H
+
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace GreekCore {
+
+    /**
+     * @brief Randomization applied to the Sobol points.
+     */
+    enum class SobolScrambling {
+        None,         ///< Plain Sobol sequence; the origin is skipped.
+        DigitalShift, ///< XOR of each coordinate with a random 32-bit shift.
+        Owen          ///< Nested uniform (Owen) scrambling, hash-based.
+    };
+
+    /**
+     * @brief Sobol low-discrepancy sequence (32-bit, Gray-code ordering).
+     *
+     * Direction numbers are those of Joe & Kuo (new-joe-kuo-6.21201), available for up to
+     * kMaxDimension dimensions. Each dimension of a point corresponds to one random factor
+     * (e.g. one time step of a path), so the first dimensions should drive the most important
+     * factors; see BrownianBridge.
+     *
+     * Any point can be reached directly with skipTo(), which lets parallel batches work on
+     * disjoint, deterministic index ranges.
+     *
+     * @cite Joe, S. and Kuo, F. Y. (2008). "Constructing Sobol sequences with better
+     *       two-dimensional projections". SIAM J. Sci. Comput. 30, 2635-2654.
+     * @cite Owen scrambling follows Burley, B. (2020). "Practical Hash-based Owen Scrambling".
+     *       Journal of Computer Graphics Techniques 9(4).
+     */
+    class SobolSequence {
+    public:
+        static constexpr size_t kMaxDimension = 1024;
+
+        /**
+         * @param dimension Number of coordinates per point (1..kMaxDimension).
+         * @param scrambling Randomization of the points.
+         * @param seed Seed of the scrambling (ignored for SobolScrambling::None).
+         * @throws std::invalid_argument If the dimension is out of range.
+         */
+        explicit SobolSequence(size_t dimension, SobolScrambling scrambling = SobolScrambling::None,
+                               uint64_t seed = 0);
+
+        size_t dimension() const { return m_dimension; }
+
+        /**
+         * @brief Positions the sequence so that the next call to next() returns point `index`.
+         * Index 0 is the first point produced (the origin is skipped when unscrambled).
+         */
+        void skipTo(uint64_t index);
+
+        /**
+         * @brief Writes the next point, with coordinates in the open interval (0, 1).
+         * @param out Span of size dimension().
+         */
+        void next(std::span<double> out);
+
+    private:
+        size_t m_dimension;
+        SobolScrambling m_scrambling;
+        uint64_t m_index;                  // Index of the next point in the raw sequence
+        std::vector<uint32_t> m_directions; // [bit][dimension]
+        std::vector<uint32_t> m_state;      // Raw integer coordinates of point m_index - 1
+        std::vector<uint32_t> m_scramble;   // Per-dimension shift or Owen seed
+
+        uint64_t firstIndex() const { return m_scrambling == SobolScrambling::None ? 1 : 0; }
+    };
+
+}
+#endif // GREEKCORE_SOBOL_H
@@ -14,6 +14,11 @@
 #include <mutex>
 #include <atomic>
 #include <concepts>
+#include <algorithm>
+#include <span>
+#include <cstdint>
+#include <limits>
+#include <array>
 
 namespace GreekCore {
 
@@ -29,6 +34,90 @@ namespace GreekCore {
         { t.getResultsSoFar() } -> std::same_as<std::vector<std::vector<double>>>;
     };
 
+    /**
+     * @brief Fixed-size result of a mean / standard error gatherer.
+     */
+    struct GathererSnapshot {
+        double mean = 0.0;
+        double std_error = 0.0;  ///< Standard error of the mean.
+        unsigned long paths = 0; ///< Results gathered so far.
+    };
+
+    /**
+     * @brief Companion concept: the gatherer writes its results into a caller-provided snapshot
+     * without allocating, so it can be polled on the hot path (progress, convergence logging).
+     */
+    template<typename T>
+    concept SnapshotGatherer = StatisticsGatherer<T> && requires(const T t, GathererSnapshot& out) {
+        { t.snapshot(out) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Gatherers whose partial results can be combined, e.g. one per worker thread reduced
+     * at the end: after `a.merge(b)`, `a` holds the statistics of both sets of results.
+     */
+    template<typename T>
+    concept MergeableGatherer = StatisticsGatherer<T> && requires(T a, const T b) {
+        { a.merge(b) } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Numerically stable running mean and variance.
+     *
+     * Welford's update per result and Chan et al.'s pairwise combination for merge(), so
+     * shards of any sizes combine without the cancellation of the sum / sum-of-squares formula.
+     */
+    struct WelfordState {
+        unsigned long count = 0;
+        double mean = 0.0;
+        double m2 = 0.0; ///< Sum of squared deviations from the mean.
+
+        void add(double x) {
+            ++count;
+            const double delta = x - mean;
+            mean += delta / count;
+            m2 += delta * (x - mean);
+        }
+
+        void merge(const WelfordState& other) {
+            if (other.count == 0) return;
+            if (count == 0) {
+                *this = other;
+                return;
+            }
+            const double n = static_cast<double>(count) + static_cast<double>(other.count);
+            const double delta = other.mean - mean;
+            mean += delta * (static_cast<double>(other.count) / n);
+            m2 += other.m2 + delta * delta * (static_cast<double>(count) * static_cast<double>(other.count) / n);
+            count += other.count;
+        }
+
+        void snapshot(GathererSnapshot& out) const {
+            out = GathererSnapshot{};
+            if (count == 0) return;
+            out.mean = mean;
+            out.paths = count;
+            const double variance = count > 1 ? std::max(m2, 0.0) / (count - 1) : 0.0;
+            out.std_error = std::sqrt(variance / count);
+        }
+    };
+
+    /**
+     * @brief Snapshot of any gatherer: allocation-free for a SnapshotGatherer, otherwise read from
+     * getResultsSoFar()[0] = [mean, standard error] (paths left at 0).
+     */
+    template<StatisticsGatherer G>
+    void takeSnapshot(const G& gatherer, GathererSnapshot& out) {
+        if constexpr (SnapshotGatherer<G>) {
+            gatherer.snapshot(out);
+        } else {
+            auto results = gatherer.getResultsSoFar();
+            out = GathererSnapshot{};
+            if (!results.empty() && !results[0].empty()) out.mean = results[0][0];
+            if (!results.empty() && results[0].size() > 1) out.std_error = results[0][1];
+        }
+    }
+
     /**
      * @brief Standard Mean and Standard Error Gatherer
      * 
@@ -53,6 +142,37 @@ namespace GreekCore {
         }
 
         std::vector<std::vector<double>> getResultsSoFar() const;
+
+        void snapshot(GathererSnapshot& out) const;
+
+        void merge(const StatisticsMean& other) {
+            m_runningSum += other.m_runningSum;
+            m_runningSumSq += other.m_runningSumSq;
+            m_pathsDone += other.m_pathsDone;
+        }
+    };
+
+    /**
+     * @brief Mean and Standard Error Gatherer using Welford's algorithm (see WelfordState).
+     */
+    class StatisticsWelford {
+    private:
+        WelfordState m_state;
+
+    public:
+        void dumpOneResult(double result) { m_state.add(result); }
+
+        std::vector<std::vector<double>> getResultsSoFar() const {
+            GathererSnapshot snap;
+            snapshot(snap);
+            return {{snap.mean, snap.std_error}}; // [Mean, StdErr]
+        }
+
+        void snapshot(GathererSnapshot& out) const { m_state.snapshot(out); }
+
+        void merge(const StatisticsWelford& other) { m_state.merge(other.m_state); }
+
+        const WelfordState& state() const { return m_state; }
     };
 
 
@@ -90,8 +210,13 @@ namespace GreekCore {
         }
 
         std::vector<std::vector<double>> getResultsSoFar() const {
-            std::vector<std::vector<double>> results(1);
-            results[0].resize(2); // [Mean, StdErr]
+            GathererSnapshot snap;
+            snapshot(snap);
+            return {{snap.mean, snap.std_error}}; // [Mean, StdErr]
+        }
+
+        void snapshot(GathererSnapshot& out) const {
+            out = GathererSnapshot{};
 
             // Load atomically. We might see a torn state (e.g. paths updated but sums not yet),
             // but for progress monitoring this is acceptable.
@@ -99,11 +224,12 @@ namespace GreekCore {
             double sum = m_runningSum.load(std::memory_order_relaxed);
             double sumSq = m_runningSumSq.load(std::memory_order_relaxed);
 
-            if (paths == 0) return results;
+            if (paths == 0) return;
 
             // Recalculate variance carefully (handling potential negatives due to torn reads)
             double mean = sum / paths;
-            results[0][0] = mean;
+            out.mean = mean;
+            out.paths = paths;
 
             // Naive variance formula: sumSq - mean * sum
             // This can be numerically unstable if sumSq and mean*sum are very close, 
@@ -117,25 +243,147 @@ namespace GreekCore {
 
             if (variance < 0.0) variance = 0.0;
             
-            double stdErr = std::sqrt(variance / paths); // Standard Error of Mean
-            results[0][1] = stdErr;
-
-            return results;
+            out.std_error = std::sqrt(variance / paths); // Standard Error of Mean
         }
     };
 
 
+    /**
+     * @brief Sharded Mean Gatherer: one cache-line-padded Welford accumulator per writer thread.
+     *
+     * Each shard has a single writer, so an update is a few relaxed loads and stores to a cache
+     * line no other thread writes (no read-modify-write, no lock). Readers combine the shards
+     * with WelfordState::merge(); like StatisticsMeanLockFree, a snapshot taken while writers
+     * are running is only eventually consistent (a shard may be seen mid-update).
+     *
+     * Shards are used either explicitly, `shard(worker).dumpOneResult(x)` with one worker index
+     * per thread, or through dumpOneResult(), which gives each calling thread its own shard on
+     * first use. Threads beyond the shard count share a mutex-protected overflow accumulator.
+     * Each thread remembers its shard for the last kThreadCacheSize gatherers it wrote to, so
+     * alternating between a few gatherers keeps one shard per thread in each of them.
+     */
+    class StatisticsSharded {
+    public:
+        static constexpr size_t kCacheLine = 64;
+        static constexpr size_t kThreadCacheSize = 8;
+
+        /// One writer thread's accumulator.
+        class alignas(kCacheLine) Shard {
+        public:
+            void dumpOneResult(double result) {
+                WelfordState state = load();
+                state.add(result);
+                m_mean.store(state.mean, std::memory_order_relaxed);
+                m_m2.store(state.m2, std::memory_order_relaxed);
+                m_count.store(state.count, std::memory_order_release);
+            }
+
+            WelfordState load() const {
+                WelfordState state;
+                state.count = m_count.load(std::memory_order_acquire);
+                state.mean = m_mean.load(std::memory_order_relaxed);
+                state.m2 = m_m2.load(std::memory_order_relaxed);
+                return state;
+            }
+
+        private:
+            std::atomic<unsigned long> m_count{0};
+            std::atomic<double> m_mean{0.0};
+            std::atomic<double> m_m2{0.0};
+        };
+
+        explicit StatisticsSharded(size_t shards)
+            : m_shards(std::make_unique<Shard[]>(std::max<size_t>(shards, 1))),
+              m_shardCount(std::max<size_t>(shards, 1)),
+              m_id(s_nextId.fetch_add(1, std::memory_order_relaxed)) {}
+
+        StatisticsSharded(const StatisticsSharded&) = delete;
+        StatisticsSharded& operator=(const StatisticsSharded&) = delete;
+
+        size_t shardCount() const { return m_shardCount; }
+
+        /// The accumulator of worker `index` (< shardCount()); one writer thread per shard.
+        Shard& shard(size_t index) { return m_shards[index]; }
+
+        void dumpOneResult(double result) {
+            const size_t index = localShard();
+            if (index < m_shardCount) {
+                m_shards[index].dumpOneResult(result);
+            } else {
+                std::lock_guard<std::mutex> lock(m_overflowMutex);
+                m_overflow.add(result);
+            }
+        }
+
+        /// Chan-merge of every shard (and the overflow); relaxed, see the class comment.
+        WelfordState state() const {
+            WelfordState total;
+            for (size_t i = 0; i < m_shardCount; ++i) total.merge(m_shards[i].load());
+            std::lock_guard<std::mutex> lock(m_overflowMutex);
+            total.merge(m_overflow);
+            return total;
+        }
+
+        void snapshot(GathererSnapshot& out) const { state().snapshot(out); }
+
+        std::vector<std::vector<double>> getResultsSoFar() const {
+            GathererSnapshot snap;
+            snapshot(snap);
+            return {{snap.mean, snap.std_error}}; // [Mean, StdErr]
+        }
+
+        /// Adds the results of `other` (taken as a whole) to this gatherer.
+        void merge(const StatisticsSharded& other) {
+            const WelfordState incoming = other.state();
+            std::lock_guard<std::mutex> lock(m_overflowMutex);
+            m_overflow.merge(incoming);
+        }
+
+    private:
+        std::unique_ptr<Shard[]> m_shards;
+        size_t m_shardCount;
+        uint64_t m_id; // never reused, unlike the address
+        std::atomic<size_t> m_nextShard{0};
+        mutable std::mutex m_overflowMutex;
+        WelfordState m_overflow;
+
+        static inline std::atomic<uint64_t> s_nextId{0};
+
+        struct CachedShard {
+            uint64_t id = std::numeric_limits<uint64_t>::max();
+            size_t index = 0;
+        };
+
+        // Shard of the calling thread, claimed on its first result. The per-thread cache holds
+        // (gatherer id, shard) pairs with round-robin eviction; an evicted gatherer claims a
+        // fresh shard on its next result, which stays correct but uses up its shards sooner.
+        size_t localShard() {
+            thread_local std::array<CachedShard, kThreadCacheSize> cache{};
+            thread_local size_t next_evicted = 0;
+            for (const CachedShard& entry : cache) {
+                if (entry.id == m_id) return entry.index;
+            }
+            CachedShard& entry = cache[next_evicted++ % kThreadCacheSize];
+            entry = {m_id, m_nextShard.fetch_add(1, std::memory_order_relaxed)};
+            return entry.index;
+        }
+    };
+
     /**
      * @brief Convergence Table Decorator (Joshi Chapter 5)
      * 
      * Wraps another gatherer and snapshots its results at specified stopping points.
      * Demonstrates compile-time Decorator Pattern using Templates.
+     *
+     * When the inner gatherer is a SnapshotGatherer the log is a GathererSnapshot per stopping
+     * point, reserved up front, so dumpOneResult() never allocates.
      */
     template<StatisticsGatherer InnerGatherer>
     class StatisticsConvergence {
     private:
         InnerGatherer m_inner; // Value semantics!
-        std::vector<std::vector<double>> m_resultsLog;
+        std::vector<std::vector<double>> m_resultsLog;  // generic inner gatherers
+        std::vector<GathererSnapshot> m_snapshotLog;    // SnapshotGatherer inner gatherers
         std::vector<unsigned long> m_stoppingPoints;
         unsigned long m_pathsDone;
         unsigned long m_currentStoppingPointIndex;
@@ -146,7 +394,9 @@ namespace GreekCore {
               m_stoppingPoints(stoppingPoints),
               m_pathsDone(0),
               m_currentStoppingPointIndex(0) 
-        {}
+        {
+            if constexpr (SnapshotGatherer<InnerGatherer>) m_snapshotLog.reserve(stoppingPoints.size());
+        }
 
         void dumpOneResult(double result) {
             m_inner.dumpOneResult(result);
@@ -154,7 +404,15 @@ namespace GreekCore {
 
             if (m_currentStoppingPointIndex < m_stoppingPoints.size() && 
                 m_pathsDone == m_stoppingPoints[m_currentStoppingPointIndex]) {
-                
+
+                if constexpr (SnapshotGatherer<InnerGatherer>) {
+                    GathererSnapshot snap;
+                    snapshot(snap);
+                    m_snapshotLog.push_back(snap);
+                    m_currentStoppingPointIndex++;
+                    return;
+                }
+
                 auto currentResults = m_inner.getResultsSoFar();
                 
                 // Store [PathCount, Mean, Err, ...]
@@ -170,6 +428,19 @@ namespace GreekCore {
         }
 
         std::vector<std::vector<double>> getResultsSoFar() const {
+            if constexpr (SnapshotGatherer<InnerGatherer>) {
+                // Same layout as the generic log: [PathCount, Mean, Err].
+                std::vector<std::vector<double>> tmp;
+                tmp.reserve(m_snapshotLog.size() + 1);
+                for (const auto& snap : m_snapshotLog) tmp.push_back({static_cast<double>(snap.paths), snap.mean, snap.std_error});
+                if (m_pathsDone > 0 && (m_snapshotLog.empty() || m_snapshotLog.back().paths != m_pathsDone)) {
+                    GathererSnapshot snap;
+                    snapshot(snap);
+                    tmp.push_back({static_cast<double>(snap.paths), snap.mean, snap.std_error});
+                }
+                return tmp;
+            }
+
             std::vector<std::vector<double>> tmp(m_resultsLog);
 
             // Also append the current state if it wasn't a stopping point
@@ -185,6 +456,15 @@ namespace GreekCore {
             return tmp;
         }
 
+        /// Current results of the inner gatherer (the path count is this decorator's own).
+        void snapshot(GathererSnapshot& out) const requires SnapshotGatherer<InnerGatherer> {
+            m_inner.snapshot(out);
+            out.paths = m_pathsDone;
+        }
+
+        /// The stopping-point log without copying (SnapshotGatherer inner gatherers).
+        std::span<const GathererSnapshot> getSnapshotLog() const { return m_snapshotLog; }
+
         // Helper to access inner (e.g., for testing or further inspection)
         const InnerGatherer& getInner() const { return m_inner; }
     };
@@ -239,6 +519,11 @@ namespace GreekCore {
             std::lock_guard<std::mutex> lock(m_mutex);
             return m_inner.getResultsSoFar();
         }
+
+        void snapshot(GathererSnapshot& out) const requires SnapshotGatherer<InnerGatherer> {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_inner.snapshot(out);
+        }
     };
 
 }
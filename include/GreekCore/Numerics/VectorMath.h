@@ -0,0 +1,49 @@
+#ifndef GREEKCORE_VECTORMATH_H
+#define GREEKCORE_VECTORMATH_H
+
+#include <span>
+#include "GreekCore/Numerics/NormalGenerator.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief Element-wise exponential: out[i] = exp(x[i]), x clamped to [-708, 709].
+     *
+     * Branch-free polynomial kernel (fdlibm, within 1 ulp of std::exp) vectorized for SSE2,
+     * AVX2 and AVX-512 and selected at runtime like NormalBatchGenerator; the output is
+     * bit-identical whichever instruction set is used.
+     *
+     * @param max_level Upper bound on the instruction set (clamped to what the CPU supports).
+     */
+    void expBatch(std::span<const double> x, std::span<double> out, SimdLevel max_level = SimdLevel::AVX512);
+
+    /**
+     * @brief One log-normal time step over a block of paths: spot[i] *= exp(drift + diffusion * z[i]).
+     *
+     * Same exp kernel as expBatch(); `spot` and `z` must have the same size.
+     */
+    void lognormalStep(std::span<double> spot, std::span<const double> z, double drift, double diffusion,
+                       SimdLevel max_level = SimdLevel::AVX512);
+
+    /**
+     * @brief Single precision expBatch(): x clamped to [-87, 88], within 2 ulp of exp, twice the
+     * lanes per instruction. Bit-identical whichever instruction set is used.
+     */
+    void expBatch(std::span<const float> x, std::span<float> out, SimdLevel max_level = SimdLevel::AVX512);
+
+    /**
+     * @brief Single precision lognormalStep() on the float exp kernel (see above).
+     */
+    void lognormalStep(std::span<float> spot, std::span<const float> z, float drift, float diffusion,
+                       SimdLevel max_level = SimdLevel::AVX512);
+
+    /**
+     * @brief x = L z for a block of `block` vectors, with L an n x n lower triangular row-major
+     * matrix and `z`, `x` stored factor-major (element i of vector p at [i * block + p]).
+     * Bit-identical for every instruction set.
+     */
+    void lowerTriangularMultiply(std::span<const double> lower, size_t n, std::span<const double> z, std::span<double> x,
+                                 size_t block, SimdLevel max_level = SimdLevel::AVX512);
+
+}
+#endif // GREEKCORE_VECTORMATH_H
@@ -0,0 +1,38 @@
+#ifndef GREEKCORE_BARRIER_H
+#define GREEKCORE_BARRIER_H
+
+#include "GreekCore/Pricing/PayOff.h"
+
+namespace GreekCore {
+
+    enum class BarrierType { UpAndOut, UpAndIn, DownAndOut, DownAndIn };
+
+    /**
+     * @brief Probability that a geometric Brownian bridge from s1 to s2 stays on the starting
+     * side of one barrier, given the variance $\int \sigma^2 dt$ of the log spot over the step.
+     *
+     * $1 - \exp(-2 \ln(H / s_1) \ln(H / s_2) / v)$ when both ends are on the same side, 0 otherwise.
+     *
+     * @cite Glasserman, P. (2004). "Monte Carlo Methods in Financial Engineering". Springer. §6.4.
+     */
+    double bridgeSurvivalProbability(double barrier, bool upper, double s1, double s2, double variance);
+
+    /**
+     * @brief Probability that a geometric Brownian bridge from s1 to s2 stays strictly between
+     * `lower` and `upper` (image series of the doubly absorbed bridge, truncated once its terms
+     * are below double precision).
+     */
+    double bridgeSurvivalProbability(double lower, double upper, double s1, double s2, double variance);
+
+    /**
+     * @brief Continuously monitored single barrier option under Black-Scholes with constant
+     * rate and volatility, no rebate (Reiner & Rubinstein 1991; knock-ins by in-out parity).
+     *
+     * A spot already on the knocked side gives 0 for knock-outs and the vanilla price for
+     * knock-ins.
+     */
+    double barrierPrice(OptionType type, BarrierType barrier_type, double S0, double K, double barrier,
+                        double r, double sigma, double T);
+
+}
+#endif // GREEKCORE_BARRIER_H
@@ -0,0 +1,73 @@
+#ifndef GREEKCORE_CONTROLVARIATE_H
+#define GREEKCORE_CONTROLVARIATE_H
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include "GreekCore/Pricing/Parameters.h"
+#include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief A control variate: a payoff correlated with the priced one whose value is known.
+     *
+     * The engine evaluates `payoff` on the same scenario as the priced payoff and reports
+     * $\bar{Y} - \beta (\bar{C} - E[C])$ with the optimal $\beta = Cov(Y, C) / Var(C)$ estimated
+     * from the same simulation. `expectation` returns the analytic (discounted) value of the
+     * control for a given market, so that bumped Greek scenarios use the matching value.
+     *
+     * @tparam ControlPayOffType Any payoff accepted by the engine for the same market data.
+     */
+    template<typename ControlPayOffType>
+    struct ControlVariate {
+        ControlPayOffType payoff;
+        std::function<double(double S0, const Parameters& r, const Parameters& sigma, double T)> expectation;
+    };
+
+    /**
+     * @brief Closed-form price of a discretely monitored geometric Asian option.
+     *
+     * Fixings at $t_k = kT/n$, $k = 1..n$, under deterministic $r(t)$ and $\sigma(t)$.
+     * $\ln G$ is normal with mean $\ln S_0 + \frac{1}{n}\sum_k (R(t_k) - V(t_k)/2)$ and variance
+     * $\frac{1}{n^2}\sum_k (2(n-k)+1) V(t_k)$, where $R(t) = \int_0^t r$ and $V(t) = \int_0^t \sigma^2$.
+     */
+    inline double geometricAsianPrice(OptionType type, double K, double S0, const Parameters& r,
+                                      const Parameters& sigma, double T, size_t steps) {
+        const double n = static_cast<double>(steps);
+        double mean = std::log(S0);
+        double variance = 0.0;
+        for (size_t k = 1; k <= steps; ++k) {
+            double t = T * k / n;
+            double V = sigma.integralSquare(0.0, t);
+            mean += (r.integral(0.0, t) - 0.5 * V) / n;
+            variance += (2.0 * (n - k) + 1.0) * V;
+        }
+        variance /= n * n;
+
+        const double df = std::exp(-r.integral(0.0, T));
+        const double vol = std::sqrt(variance);
+        const double forward = std::exp(mean + 0.5 * variance);
+        const double d1 = (mean - std::log(K) + variance) / vol;
+        const double d2 = d1 - vol;
+
+        if (type == OptionType::Call) {
+            return df * (forward * cumulativeNormal(d1) - K * cumulativeNormal(d2));
+        }
+        return df * (K * cumulativeNormal(-d2) - forward * cumulativeNormal(-d1));
+    }
+
+    /**
+     * @brief Geometric Asian control for pricing the arithmetic PayOffAsian with pricePathDependent.
+     * Use the same type, strike and number of steps as the priced option.
+     */
+    inline ControlVariate<PayOffGeometricAsian> makeGeometricAsianControl(OptionType type, double K, size_t steps) {
+        return {PayOffGeometricAsian(type, K),
+                [type, K, steps](double S0, const Parameters& r, const Parameters& sigma, double T) {
+                    return geometricAsianPrice(type, K, S0, r, sigma, T, steps);
+                }};
+    }
+
+}
+#endif // GREEKCORE_CONTROLVARIATE_H
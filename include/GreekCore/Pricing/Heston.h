@@ -0,0 +1,93 @@
+#ifndef GREEKCORE_HESTON_H
+#define GREEKCORE_HESTON_H
+
+#include <cstddef>
+#include <vector>
+#include "GreekCore/Pricing/Parameters.h"
+#include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Pricing/TimeGrid.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief Heston stochastic volatility model under the pricing measure:
+     *
+     * $dS = r S dt + \sqrt{v} S dW_S$, $dv = \kappa(\theta - v) dt + \xi \sqrt{v} dW_v$,
+     * $d\langle W_S, W_v \rangle = \rho dt$.
+     */
+    struct HestonParameters {
+        double v0;    ///< Initial variance.
+        double kappa; ///< Mean-reversion speed of the variance.
+        double theta; ///< Long-run variance.
+        double xi;    ///< Volatility of variance.
+        double rho;   ///< Correlation of the spot and variance Brownian motions.
+    };
+
+    /**
+     * @brief Semi-analytic European price under Heston with a constant rate.
+     *
+     * Lewis (2001) single-integral formula with the "little Heston trap" form of the
+     * characteristic function, integrated by adaptive Gauss-Legendre quadrature.
+     *
+     * @cite Albrecher, H., Mayer, P., Schoutens, W. & Tistaert, J. (2007). "The Little Heston Trap".
+     * @throws std::invalid_argument If the parameters are not a valid Heston model.
+     */
+    double hestonPrice(OptionType type, double S0, double K, double r, double T, const HestonParameters& heston);
+
+    /**
+     * @brief Andersen's quadratic-exponential (QE) discretization of Heston on a TimeGrid.
+     *
+     * Every grid interval is split into equal steps no longer than `max_time_step` (0 = one
+     * step per interval). The variance is sampled from the moment-matched quadratic (psi <= 1.5)
+     * or exponential-mixture law; the log spot uses the central (gamma1 = gamma2 = 1/2)
+     * integrated-variance approximation with the martingale correction, so that the discounted
+     * spot is an exact martingale over each step whenever the correction exists.
+     *
+     * @cite Andersen, L. (2008). "Simple and efficient simulation of the Heston stochastic
+     *       volatility model". Journal of Computational Finance 11(3).
+     */
+    class HestonQEScheme {
+    public:
+        /**
+         * @throws std::invalid_argument If the parameters are not a valid Heston model.
+         */
+        HestonQEScheme(const HestonParameters& heston, const Parameters& r, const TimeGrid& grid,
+                       double max_time_step = 0.0);
+
+        /// Total number of QE steps (each uses two normals: variance, then spot).
+        size_t steps() const { return m_steps.size(); }
+
+        /// QE steps ending on grid interval j (the interval (t_{j-1}, t_j]).
+        size_t stepsInInterval(size_t j) const { return m_interval_steps[j]; }
+
+        /// Discount factor to the grid maturity.
+        double discountFactor() const { return m_discount; }
+
+        double initialVariance() const { return m_v0; }
+
+        /**
+         * @brief Advances (log spot, variance) over step k.
+         * @param z_v Normal driving the variance (mapped to a uniform in the exponential regime).
+         * @param z_x Independent normal driving the spot.
+         */
+        void advance(size_t k, double& log_spot, double& variance, double z_v, double z_x) const;
+
+    private:
+        struct Step {
+            double decay;    // e^{-kappa dt}; variance mean m = theta (1 - decay) + decay * v
+            double s2_v;     // variance of the variance: s2 = s2_v * v + s2_c
+            double s2_c;
+            double drift;    // integral of r over the step
+            double k1, k2, k3, k4;
+            double k0;       // uncorrected K0 (fallback when the martingale correction does not exist)
+        };
+
+        std::vector<Step> m_steps;
+        std::vector<size_t> m_interval_steps;
+        double m_theta;
+        double m_v0;
+        double m_discount;
+    };
+
+}
+#endif // GREEKCORE_HESTON_H
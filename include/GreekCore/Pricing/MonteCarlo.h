@@ -25,8 +25,36 @@
 #include <functional>
 #include <numbers>
 #include <future>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <mutex>
+#include <cstdint>
+#include <array>
+#include <span>
+#include <ranges>
+#include <tuple>
+#include <optional>
+#include <type_traits>
+#include <chrono>
+#include <stop_token>
 #include "GreekCore/Numerics/RNG.h"
+#include "GreekCore/Numerics/NormalGenerator.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+#include "GreekCore/Numerics/Sobol.h"
+#include "GreekCore/Numerics/BrownianBridge.h"
+#include "GreekCore/Numerics/AAD.h"
+#include "GreekCore/Numerics/VectorMath.h"
 #include "GreekCore/Pricing/Parameters.h"
+#include "GreekCore/Pricing/ControlVariate.h"
+#include "GreekCore/Pricing/TimeGrid.h"
+#include "GreekCore/Pricing/StreamingPayOff.h"
+#include "GreekCore/Pricing/Heston.h"
+#include "GreekCore/Pricing/MultiAssetPayOff.h"
+#include "GreekCore/Numerics/Cholesky.h"
+#include "GreekCore/Numerics/LeastSquares.h"
+#include "GreekCore/Utils/ThreadPool.h"
 #include "GreekCore/Numerics/Statistics.h"
 
 namespace GreekCore {
@@ -45,6 +73,446 @@ namespace GreekCore {
         double runtime_ms;     ///< Execution time in milliseconds.
     };
 
+    /**
+     * @brief Price and first-order sensitivities to every model input, computed by AAD.
+     */
+    struct MonteCarloAADResult {
+        double price;                           ///< Estimated option price.
+        double error_estimate;                  ///< Standard error of the price.
+        double delta;                           ///< $\partial V / \partial S_0$.
+        std::vector<double> rate_sensitivities; ///< $\partial V$ / each node of r (Parameters::node()).
+        std::vector<double> vol_sensitivities;  ///< $\partial V$ / each node of sigma.
+    };
+
+    /**
+     * @brief Why priceToTolerance() or a cancellable asynchronous run stopped simulating.
+     */
+    enum class StopReason {
+        Tolerance, ///< The standard error reached the target.
+        MaxPaths,  ///< The path budget (all requested paths) was used up first.
+        Deadline,  ///< The wall-clock deadline passed first.
+        Cancelled  ///< Stop was requested through the std::stop_token.
+    };
+
+    /**
+     * @brief Stopping rule of priceToTolerance(); whichever criterion is met first wins.
+     */
+    struct ToleranceSettings {
+        double tolerance = 0.0;                   ///< Target standard error of the price.
+        size_t max_paths = size_t{1} << 24;       ///< Path budget.
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        size_t min_paths = 4096;                  ///< The error estimate is not trusted before this many paths.
+        std::stop_token stop;                     ///< Checked with the deadline after every round.
+    };
+
+    /**
+     * @brief Result of a run that may stop before its path budget: priceToTolerance() and the
+     * cancellable priceEuropeanAsync() overloads. Price and error describe the paths simulated.
+     */
+    struct MonteCarloRunResult {
+        double price;           ///< Estimated option price.
+        double error_estimate;  ///< Standard error of the price.
+        size_t paths;           ///< Paths actually simulated.
+        StopReason stop_reason; ///< Criterion that ended the simulation.
+    };
+
+    using MonteCarloToleranceResult = MonteCarloRunResult;
+
+    /**
+     * @brief Market of priceMultiAsset(): correlated Black-Scholes assets with a common rate.
+     */
+    struct MultiAssetMarket {
+        std::vector<double> spots;        ///< Initial spot of each asset.
+        Parameters r;                     ///< Risk-free rate.
+        std::vector<Parameters> vols;     ///< Volatility term structure of each asset.
+        std::vector<double> correlation;  ///< Row-major correlation matrix of the asset Brownian motions.
+    };
+
+    /**
+     * @brief Regression and memory settings of the Longstaff-Schwartz pricers (priceBermudan(),
+     * priceAmerican()).
+     */
+    struct EarlyExerciseSettings {
+        RegressionBasis basis = RegressionBasis::Polynomial;
+        size_t basis_size = 4;       ///< Regression functions of S / S0 per exercise date, including the constant.
+        size_t regression_paths = 0; ///< Paths of the regression pass (0 = as many as the pricing pass).
+
+        /// Largest path matrix (regression paths x exercise dates doubles, in bytes) the regression
+        /// pass may store; above it, the paths are regenerated from their batch's RNG stream at
+        /// every exercise date instead (O(dates^2) simulation, O(paths) memory). 0 = unlimited.
+        size_t memory_budget = size_t{1} << 30;
+    };
+
+    /**
+     * @brief Settings of the multilevel Monte Carlo driver (priceMultilevel()).
+     *
+     * Level l simulates base_steps * 2^l time steps. The orders describe how fast the level
+     * corrections $Y_l = P_l - P_{l-1}$ decay: $|E[Y_l]| \sim 2^{-\alpha l}$ (bias) and
+     * $V[Y_l] \sim 2^{-\beta l}$; 0 estimates them from the simulated levels.
+     */
+    struct MultilevelSettings {
+        double target_rmse = 0.01;   ///< Root mean square error target (bias and statistical error).
+        size_t base_steps = 1;       ///< Time steps of level 0.
+        size_t min_levels = 3;       ///< Levels simulated before the bias test.
+        size_t max_levels = 10;      ///< Finest level is max_levels - 1.
+        size_t initial_paths = 2000; ///< Pilot paths of every new level.
+        double weak_order = 0.0;     ///< alpha (0 = estimated, at least 0.5).
+        double variance_order = 0.0; ///< beta (0 = estimated, at least 0.5).
+    };
+
+    /**
+     * @brief Statistics of one level of a multilevel run, for tuning.
+     */
+    struct MultilevelLevel {
+        size_t steps;    ///< Time steps of the fine paths of the level.
+        size_t paths;    ///< Paths simulated.
+        double mean;     ///< Estimate of E[P_0] (level 0) or of the correction E[P_l - P_{l-1}].
+        double variance; ///< Sample variance of one path's correction.
+        double cost;     ///< Cost of one path, in simulated time steps.
+        double seconds;  ///< Wall-clock time spent on the level.
+    };
+
+    /**
+     * @brief Result of priceMultilevel().
+     */
+    struct MultilevelResult {
+        double price;                        ///< Sum of the level means.
+        double error_estimate;               ///< Standard error: $\sqrt{\sum_l V_l / N_l}$.
+        double bias_estimate;                ///< Estimated bias of the finest level.
+        bool converged;                      ///< Whether the bias test passed before max_levels.
+        std::vector<MultilevelLevel> levels;
+    };
+
+    /**
+     * @brief Per-payoff results of pricePortfolio(), stored as columns (structure of arrays).
+     *
+     * Entry i of each column belongs to the i-th payoff, counting the payoffs of every book
+     * argument in order.
+     */
+    struct PortfolioResult {
+        std::vector<double> price;          ///< Estimated price of each payoff.
+        std::vector<double> error_estimate; ///< Standard error of each price.
+        size_t paths = 0;                   ///< Paths shared by all payoffs.
+
+        size_t size() const { return price.size(); }
+    };
+
+    /**
+     * @brief How the engine samples its random factors.
+     */
+    enum class SamplingMethod {
+        PseudoRandom, ///< Xoshiro256 streams through NormalBatchGenerator.
+        QuasiRandom   ///< Sobol points (one dimension per time step) through the inverse normal CDF.
+    };
+
+    /**
+     * @brief How the finite-difference Greeks are simulated.
+     *
+     * The finite-difference modes price every bumped market on the same normals (common random
+     * numbers) and return identical results; they only differ in cost.
+     */
+    enum class GreeksMode {
+        SinglePass, ///< Draw each path once and evaluate all bumped markets on it.
+        Repricing,  ///< Re-run the whole simulation for each bumped market.
+        Estimators  ///< priceEuropean only: delta, gamma, vega and rho from the payoff's pathwise or
+                    ///< likelihood-ratio estimator (see GreekEstimator) in the pricing pass; theta by
+                    ///< SinglePass finite difference. Payoffs without an estimator fall back to SinglePass.
+    };
+
+    /**
+     * @brief Floating-point type of the simulated path state (normals and spots).
+     */
+    enum class Precision {
+        Double, ///< Everything in double precision.
+        Float   ///< Normals and structure-of-arrays spots in float: twice the SIMD lanes and half the
+                ///< buffer memory. Payoffs, discounting and statistics stay in double; spots carry a
+                ///< relative error of about 6e-8 per step and pseudo-random normals are cut at |z| = 5.65.
+    };
+
+    /**
+     * @brief Importance sampling of the terminal normal of the European engines.
+     *
+     * The normal $z$ driving $S_T$ is drawn from $N(\mu, 1)$ instead of $N(0, 1)$ and each path
+     * is weighted by the likelihood ratio $\phi(z) / \phi(z - \mu) = e^{\mu^2 / 2 - \mu z}$, which
+     * keeps every estimate unbiased. Shifting towards the region where the payoff is non-zero
+     * makes far out-of-the-money digitals pay on most paths instead of almost none.
+     */
+    struct ImportanceSampling {
+        /// Mean shift $\mu$ of the normal (0 = plain sampling).
+        double shift = 0.0;
+
+        /// Use $\mu = E[z \mid S_T(z) \in$ payoff region$]$, from the payoff's RegionPayOff::payoffRegion()
+        /// (strike vs. forward) in the base market; `shift` is then ignored.
+        bool automatic = false;
+    };
+
+    /**
+     * @brief Execution settings for the Monte Carlo engine.
+     *
+     * Paths are split into fixed-size batches. Batch k always draws from StreamFactory
+     * stream k (the root stream jumped k times, never overlapping) and keeps its own
+     * statistics; batches are merged in index order. The work decomposition therefore only
+     * depends on `seed` and `paths_per_batch`, so results are bit-identical for any `threads`.
+     */
+    struct MonteCarloSettings {
+        uint64_t seed = 42;             ///< Seed of the root Xoshiro256 stream (and of the Sobol scrambling).
+        size_t threads = 1;             ///< Parallel workers on ThreadPool::global(), including the caller (0 = hardware_concurrency()).
+        size_t paths_per_batch = 16384; ///< Paths per RNG stream (the unit of parallel work).
+
+        SamplingMethod sampling = SamplingMethod::PseudoRandom;
+        SobolScrambling scrambling = SobolScrambling::Owen; ///< QuasiRandom only.
+        bool brownian_bridge = true;    ///< QuasiRandom only: build multi-step paths by Brownian bridge.
+
+        /// Also evaluate each path at -z; the sample is the average of the pair, so `paths`
+        /// counts pairs and the error estimate accounts for their correlation.
+        bool antithetic = false;
+
+        GreeksMode greeks = GreeksMode::SinglePass;
+
+        /// pricePathDependent only: simulate blocks of this many paths together, one time step at
+        /// a time, on structure-of-arrays spots with a vectorized exp (lognormalStep()); 0 or 1
+        /// simulates one path at a time. Paths use the same normals either way, so prices agree
+        /// up to the rounding of exp. Typical values: 256 - 1024.
+        size_t path_block = 0;
+
+        /// pricePathDependent with path_block > 1: precision of the simulated paths, see Precision.
+        /// Float paths use different normals (NormalBatchGenerator's float stream), so prices agree
+        /// with Double ones within the statistical error only.
+        Precision precision = Precision::Double;
+
+        /// priceEuropean, priceToTolerance and the split priceEuropeanAsync: drift shift of the
+        /// terminal normal, see ImportanceSampling.
+        ImportanceSampling importance_sampling;
+
+        /// Stochastic volatility engines (priceHeston): longest simulation step; grid intervals are
+        /// split into equal steps no longer than this, the payoff still observes the grid only.
+        /// 0 simulates one step per grid interval.
+        double max_time_step = 0.0;
+    };
+
+    /**
+     * @brief Source of standard normals for one batch of paths, following MonteCarloSettings.
+     *
+     * Each path consumes `factors` normals (one per time step). Pseudo-random sampling draws
+     * them from the batch's Xoshiro256 stream; quasi-random sampling uses Sobol points
+     * `first_path, first_path + 1, ...` of dimension `factors`, so batches cover disjoint
+     * index ranges, optionally reordered through a Brownian bridge.
+     *
+     * Note: with quasi-random sampling the paths are not independent and the reported
+     * standard error (computed as if they were) is a conservative upper bound.
+     */
+    class PathNormals {
+    public:
+        /**
+         * @param bridge Optional Brownian bridge over the `factors` time steps (QuasiRandom only).
+         */
+        PathNormals(const MonteCarloSettings& settings, size_t factors, uint64_t first_path,
+                    const Xoshiro256& rng, const BrownianBridge* bridge = nullptr)
+            : m_factors(factors), m_normals(rng),
+              m_bridge(settings.brownian_bridge && factors > 1 ? bridge : nullptr) {
+            if (settings.sampling == SamplingMethod::QuasiRandom) {
+                m_sobol.emplace(factors, settings.scrambling, settings.seed);
+                m_sobol->skipTo(first_path);
+                m_point.resize(factors);
+            }
+        }
+
+        /**
+         * @brief Fills consecutive paths' normals; z.size() must be a multiple of `factors`.
+         */
+        void fill(std::span<double> z) { fillPaths(z); }
+
+        /**
+         * @brief Single precision fill(): NormalBatchGenerator's float stream (pseudo-random) or
+         * the double Sobol normals rounded to float (quasi-random).
+         */
+        void fill(std::span<float> z) { fillPaths(z); }
+
+    private:
+        template<typename Real>
+        void fillPaths(std::span<Real> z) {
+            if (!m_sobol) {
+                m_normals.fill(z);
+                return;
+            }
+            for (size_t offset = 0; offset < z.size(); offset += m_factors) {
+                auto path = z.subspan(offset, m_factors);
+                m_sobol->next(m_point);
+                if (m_bridge) {
+                    for (double& u : m_point) u = inverseCumulativeNormal(u);
+                    if constexpr (std::is_same_v<Real, double>) {
+                        m_bridge->transform(m_point, path);
+                    } else {
+                        m_increments.resize(m_factors);
+                        m_bridge->transform(m_point, m_increments);
+                        std::copy(m_increments.begin(), m_increments.end(), path.begin());
+                    }
+                } else {
+                    for (size_t j = 0; j < m_factors; ++j) path[j] = static_cast<Real>(inverseCumulativeNormal(m_point[j]));
+                }
+            }
+        }
+
+        size_t m_factors;
+        NormalBatchGenerator m_normals;
+        std::optional<SobolSequence> m_sobol; // pseudo-random sampling when empty
+        std::vector<double> m_point;
+        std::vector<double> m_increments; // bridge output of single precision fills
+        const BrownianBridge* m_bridge;
+    };
+
+    namespace detail {
+
+        /// Passes one observation to a streaming payoff, with the step variance if it takes one.
+        template<StreamingPayOff PayoffType>
+        void observeStreaming(PayoffType& state, double t, double spot, double step_variance) {
+            if constexpr (StepVarianceObserver<PayoffType>) {
+                state.observe(t, spot, step_variance);
+            } else {
+                state.observe(t, spot);
+            }
+        }
+
+        /**
+         * @brief Feeds one simulated path to a path-dependent payoff.
+         * Vector payoffs (the fallback) get the materialized path; see the StreamingPayOff specialization.
+         * `step_variance` is the variance of the log spot since the previous observation.
+         */
+        template<typename PayoffType>
+        class PathEvaluator {
+        public:
+            PathEvaluator(const PayoffType& payoff, size_t steps) : m_payoff(&payoff), m_path(steps) {}
+            void begin(double /*spot*/) {}
+            void observe(size_t j, double /*t*/, double spot, double /*step_variance*/) { m_path[j] = spot; }
+            double finish() { return (*m_payoff)(m_path); }
+        private:
+            const PayoffType* m_payoff;
+            std::vector<double> m_path;
+        };
+
+        /// Terminal payoffs (on the spot at maturity) only keep the last spot.
+        template<typename PayoffType>
+            requires (!StreamingPayOff<PayoffType> && std::is_invocable_r_v<double, const PayoffType&, double>)
+        class PathEvaluator<PayoffType> {
+        public:
+            PathEvaluator(const PayoffType& payoff, size_t /*steps*/) : m_payoff(&payoff) {}
+            void begin(double spot) { m_spot = spot; }
+            void observe(size_t /*j*/, double /*t*/, double spot, double /*step_variance*/) { m_spot = spot; }
+            double finish() { return (*m_payoff)(m_spot); }
+        private:
+            const PayoffType* m_payoff;
+            double m_spot = 0.0;
+        };
+
+        /// Streaming payoffs keep their own O(1) state; no path is stored.
+        template<StreamingPayOff PayoffType>
+        class PathEvaluator<PayoffType> {
+        public:
+            PathEvaluator(const PayoffType& payoff, size_t /*steps*/) : m_state(payoff) {}
+            void begin(double spot) { m_state.reset(spot); }
+            void observe(size_t /*j*/, double t, double spot, double step_variance) {
+                observeStreaming(m_state, t, spot, step_variance);
+            }
+            double finish() { return m_state.finish(); }
+        private:
+            PayoffType m_state;
+        };
+
+
+        /**
+         * @brief PathEvaluator for a block of paths advanced together (MonteCarloSettings::path_block).
+         * The vector fallback keeps the block's spots step-major and gathers each path at finish().
+         * Spots may be float (Precision::Float); payoffs always see them as double.
+         */
+        template<typename PayoffType>
+        class BlockPathEvaluator {
+        public:
+            BlockPathEvaluator(const PayoffType& payoff, size_t steps, size_t block)
+                : m_payoff(&payoff), m_block(block), m_history(steps * block), m_path(steps) {}
+            template<typename Real>
+            void begin(std::span<Real> /*spot*/) {}
+            template<typename Real>
+            void observe(size_t j, double /*t*/, std::span<Real> spot, double /*step_variance*/) {
+                std::copy(spot.begin(), spot.end(), m_history.begin() + j * m_block);
+            }
+            double finish(size_t k) {
+                for (size_t j = 0; j < m_path.size(); ++j) m_path[j] = m_history[j * m_block + k];
+                return (*m_payoff)(m_path);
+            }
+        private:
+            const PayoffType* m_payoff;
+            size_t m_block;
+            std::vector<double> m_history; // m_history[j * m_block + k]: spot of path k at step j
+            std::vector<double> m_path;
+        };
+
+        /// Payoffs of one type in a pricePortfolio() book: a single payoff or a contiguous range of them.
+        template<typename Book>
+        auto bookPayOffs(const Book& book) {
+            if constexpr (std::ranges::contiguous_range<Book>) {
+                return std::span<const std::ranges::range_value_t<Book>>(book);
+            } else {
+                return std::span<const Book>(&book, 1);
+            }
+        }
+
+        /**
+         * @brief Evaluates every payoff of a book on one shared, materialized path.
+         * Terminal payoffs get the last spot, vector payoffs the path and streaming payoffs a
+         * replay of it (their per-payoff state is kept here; `diffusion` gives the step variances).
+         */
+        template<typename PayoffType>
+        class BookEvaluator {
+        public:
+            explicit BookEvaluator(std::span<const PayoffType> payoffs) : m_payoffs(payoffs) {
+                if constexpr (StreamingPayOff<PayoffType>) m_states.assign(payoffs.begin(), payoffs.end());
+            }
+
+            void evaluate(double S0, std::span<const double> times, std::span<const double> diffusion,
+                          const std::vector<double>& path, double* out) {
+                if constexpr (StreamingPayOff<PayoffType>) {
+                    for (size_t i = 0; i < m_states.size(); ++i) {
+                        m_states[i].reset(S0);
+                        for (size_t j = 0; j < path.size(); ++j) {
+                            observeStreaming(m_states[i], times[j], path[j], diffusion[j] * diffusion[j]);
+                        }
+                        out[i] = m_states[i].finish();
+                    }
+                } else if constexpr (std::is_invocable_r_v<double, const PayoffType&, double>) {
+                    const double spot = path.back();
+                    for (size_t i = 0; i < m_payoffs.size(); ++i) out[i] = m_payoffs[i](spot);
+                } else {
+                    for (size_t i = 0; i < m_payoffs.size(); ++i) out[i] = m_payoffs[i](path);
+                }
+            }
+
+            size_t size() const { return m_payoffs.size(); }
+
+        private:
+            std::span<const PayoffType> m_payoffs;
+            std::vector<PayoffType> m_states;
+        };
+
+        /// Streaming payoffs: one state per path of the block.
+        template<StreamingPayOff PayoffType>
+        class BlockPathEvaluator<PayoffType> {
+        public:
+            BlockPathEvaluator(const PayoffType& payoff, size_t /*steps*/, size_t block) : m_states(block, payoff) {}
+            template<typename Real>
+            void begin(std::span<Real> spot) {
+                for (size_t k = 0; k < spot.size(); ++k) m_states[k].reset(spot[k]);
+            }
+            template<typename Real>
+            void observe(size_t /*j*/, double t, std::span<Real> spot, double step_variance) {
+                for (size_t k = 0; k < spot.size(); ++k) observeStreaming(m_states[k], t, spot[k], step_variance);
+            }
+            double finish(size_t k) { return m_states[k].finish(); }
+        private:
+            std::vector<PayoffType> m_states;
+        };
+
+    }
+
     /**
      * @brief High-Performance Monte Carlo Pricing Engine.
      * 
@@ -58,12 +526,344 @@ namespace GreekCore {
             double std_err;
         };
 
-        // Core engine that pushes results to a Gatherer
+        // Running sums of one batch of paths. Merged in batch order for reproducibility.
+        struct PathAccumulator {
+            double sum = 0.0;
+            double sum_sq = 0.0;
+            size_t count = 0;
+
+            void add(double value) {
+                sum += value;
+                sum_sq += value * value;
+                ++count;
+            }
+
+            void merge(const PathAccumulator& other) {
+                sum += other.sum;
+                sum_sq += other.sum_sq;
+                count += other.count;
+            }
+
+            SimResult result(double scale) const {
+                double mean = (count > 0) ? (sum / count) : 0.0;
+                double variance = (count > 1) ? ((sum_sq - count * mean * mean) / (count - 1)) : 0.0;
+                if (variance < 0) variance = 0.0;
+                double std_err = (count > 0) ? std::sqrt(variance) / std::sqrt(count) : 0.0;
+                return {mean * scale, std_err * scale};
+            }
+        };
+
+        // Running co-moments of (payoff, control) of one batch, merged with Chan's formulas.
+        struct ControlAccumulator {
+            size_t count = 0;
+            double mean_y = 0.0;
+            double mean_c = 0.0;
+            double m2_y = 0.0;
+            double m2_c = 0.0;
+            double c_yc = 0.0;
+
+            void add(double y, double c) {
+                ++count;
+                double dy = y - mean_y;
+                double dc = c - mean_c;
+                mean_y += dy / count;
+                mean_c += dc / count;
+                m2_y += dy * (y - mean_y);
+                m2_c += dc * (c - mean_c);
+                c_yc += dy * (c - mean_c);
+            }
+
+            void merge(const ControlAccumulator& other) {
+                if (other.count == 0) return;
+                if (count == 0) {
+                    *this = other;
+                    return;
+                }
+                double n = static_cast<double>(count + other.count);
+                double dy = other.mean_y - mean_y;
+                double dc = other.mean_c - mean_c;
+                double w = static_cast<double>(count) * other.count / n;
+                m2_y += other.m2_y + dy * dy * w;
+                m2_c += other.m2_c + dc * dc * w;
+                c_yc += other.c_yc + dy * dc * w;
+                mean_y += dy * other.count / n;
+                mean_c += dc * other.count / n;
+                count += other.count;
+            }
+
+            // Control-variate estimate with the optimal beta = Cov(Y, C) / Var(C) of the sample.
+            // The error is that of the regression residual Y - beta * C.
+            SimResult result(double scale, double control_expectation) const {
+                if (count == 0) return {0.0, 0.0};
+                double beta = (m2_c > 0.0) ? c_yc / m2_c : 0.0;
+                double price = scale * (mean_y - beta * mean_c) + beta * control_expectation;
+                double variance = (count > 1) ? (m2_y - beta * c_yc) / (count - 1) : 0.0;
+                if (variance < 0) variance = 0.0;
+                return {price, scale * std::sqrt(variance / count)};
+            }
+        };
+
+        // Per-batch price samples and summed input adjoints of the AAD engine.
+        struct AADAccumulator {
+            PathAccumulator value;
+            std::vector<double> gradient;
+
+            void merge(const AADAccumulator& other) {
+                value.merge(other.value);
+                if (gradient.size() < other.gradient.size()) gradient.resize(other.gradient.size(), 0.0);
+                for (size_t i = 0; i < other.gradient.size(); ++i) gradient[i] += other.gradient[i];
+            }
+        };
+
+        // Records the integral (or integralSquare) of `p` over [t1, t2] as a function of its nodes.
+        static Number recordIntegral(const Parameters& p, std::span<const Number> nodes, double t1, double t2,
+                                     bool square, std::span<double> gradient) {
+            double value;
+            if (square) {
+                value = p.integralSquare(t1, t2);
+                p.integralSquareGradient(t1, t2, gradient);
+            } else {
+                value = p.integral(t1, t2);
+                p.integralGradient(t1, t2, gradient);
+            }
+
+            Tape& tape = Tape::local();
+            size_t node = Tape::kConstant;
+            for (size_t j = 0; j < nodes.size(); ++j) {
+                if (gradient[j] != 0.0) node = tape.record(node, 1.0, nodes[j].node(), gradient[j]);
+            }
+            return Number::fromNode(value, node);
+        }
+
+        /**
+         * Adjoint engine shared by the AAD pricers: simulates the spot on `grid` on Numbers
+         * and evaluates `evaluate(const std::vector<Number>& path) -> Number`.
+         *
+         * Per batch, the inputs (S0 and the nodes of r and sigma) and the step coefficients are
+         * recorded once, then each path is recorded, propagated back to that checkpoint and
+         * rewound, so the tape only ever holds one path. Batches run on the caller's thread too,
+         * so each one leaves the nodes and mark already on the tape untouched.
+         */
+        template<typename EvaluateFunc>
+        static MonteCarloAADResult aadEngine(double S0, const Parameters& r, const Parameters& sigma, const TimeGrid& grid,
+                                             size_t paths, const MonteCarloSettings& settings,
+                                             EvaluateFunc&& evaluate) {
+            const size_t steps = grid.size();
+            const size_t n_r = r.nodeCount();
+            const size_t n_sigma = sigma.nodeCount();
+            const BrownianBridge bridge(grid.times());
+            // European: blocks of normals as priceEuropean; multi-step: one path at a time as pricePathDependent.
+            const size_t block_paths = (steps == 1) ? kNormalBlock : 1;
+
+            AADAccumulator total = runBatches<AADAccumulator>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, AADAccumulator& acc) {
+                Tape& tape = Tape::local();
+                const size_t tape_start = tape.size();
+                const size_t caller_mark = tape.markPosition();
+
+                Number spot = Number::input(S0);
+                std::vector<Number> r_nodes(n_r), sigma_nodes(n_sigma);
+                for (size_t i = 0; i < n_r; ++i) r_nodes[i] = Number::input(r.node(i));
+                for (size_t i = 0; i < n_sigma; ++i) sigma_nodes[i] = Number::input(sigma.node(i));
+
+                std::vector<double> gradient(std::max(n_r, n_sigma));
+                Number df = exp(-recordIntegral(r, r_nodes, 0.0, grid.maturity(), false, gradient));
+                std::vector<Number> drift(steps), diff(steps);
+                double current_time = 0.0;
+                for (size_t j = 0; j < steps; ++j) {
+                    double next_time = grid[j];
+                    Number r_step = recordIntegral(r, r_nodes, current_time, next_time, false, gradient);
+                    Number vol_sq_step = recordIntegral(sigma, sigma_nodes, current_time, next_time, true, gradient);
+                    drift[j] = r_step - 0.5 * vol_sq_step;
+                    diff[j] = sqrt(vol_sq_step);
+                    current_time = next_time;
+                }
+                tape.mark();
+                const size_t batch_mark = tape.size();
+
+                PathNormals normals(settings, steps, first_path, rng, &bridge);
+                std::vector<double> z(block_paths * steps);
+                std::vector<Number> path(steps);
+                std::vector<Number> path_anti(settings.antithetic ? steps : 0);
+
+                for (size_t block_start = 0; block_start < n; block_start += block_paths) {
+                    const size_t block = std::min(block_paths, n - block_start);
+                    normals.fill(std::span<double>(z.data(), block * steps));
+
+                    for (size_t k = 0; k < block; ++k) {
+                        const double* zk = z.data() + k * steps;
+                        Number current_S = spot;
+                        Number current_S_anti = spot;
+                        for (size_t j = 0; j < steps; ++j) {
+                            current_S = current_S * exp(drift[j] + diff[j] * zk[j]);
+                            path[j] = current_S;
+                            if (settings.antithetic) {
+                                current_S_anti = current_S_anti * exp(drift[j] - diff[j] * zk[j]);
+                                path_anti[j] = current_S_anti;
+                            }
+                        }
+
+                        Number value = evaluate(path);
+                        if (settings.antithetic) value = 0.5 * (value + evaluate(path_anti));
+                        value = value * df;
+
+                        acc.value.add(value.value());
+                        value.setAdjoint(1.0);
+                        tape.propagateToMark();
+                        tape.rewindToMark();
+                    }
+                }
+
+                tape.propagate(tape_start, batch_mark);
+                acc.gradient.resize(1 + n_r + n_sigma);
+                acc.gradient[0] = spot.adjoint();
+                for (size_t i = 0; i < n_r; ++i) acc.gradient[1 + i] = r_nodes[i].adjoint();
+                for (size_t i = 0; i < n_sigma; ++i) acc.gradient[1 + n_r + i] = sigma_nodes[i].adjoint();
+                tape.rewind(tape_start);
+                tape.mark(caller_mark);
+            });
+
+            SimResult res = total.value.result(1.0);
+            MonteCarloAADResult result{res.price, res.std_err, 0.0, std::vector<double>(n_r), std::vector<double>(n_sigma)};
+            const size_t count = total.value.count;
+            if (count > 0 && !total.gradient.empty()) {
+                result.delta = total.gradient[0] / count;
+                for (size_t i = 0; i < n_r; ++i) result.rate_sensitivities[i] = total.gradient[1 + i] / count;
+                for (size_t i = 0; i < n_sigma; ++i) result.vol_sensitivities[i] = total.gradient[1 + n_r + i] / count;
+            }
+            return result;
+        }
+
+        // Placeholder control type of the engines when no control variate is used.
+        struct NoControl {};
+
+        template<typename ControlPayOffType>
+        static detail::PathEvaluator<ControlPayOffType> makeControlEvaluator(const ControlVariate<ControlPayOffType>& control, size_t steps) {
+            return detail::PathEvaluator<ControlPayOffType>(control.payoff, steps);
+        }
+
+        static NoControl makeControlEvaluator(const NoControl&, size_t) { return {}; }
+
+        template<typename ControlPayOffType>
+        static detail::BlockPathEvaluator<ControlPayOffType> makeBlockControlEvaluator(const ControlVariate<ControlPayOffType>& control,
+                                                                                       size_t steps, size_t block) {
+            return detail::BlockPathEvaluator<ControlPayOffType>(control.payoff, steps, block);
+        }
+
+        static NoControl makeBlockControlEvaluator(const NoControl&, size_t, size_t) { return {}; }
+
+        // Normals are drawn in blocks of this size through NormalBatchGenerator.
+        static constexpr size_t kNormalBlock = 1024;
+
+        static size_t resolveThreads(size_t requested) {
+            if (requested != 0) return requested;
+            size_t hw = std::thread::hardware_concurrency();
+            return hw > 0 ? hw : 1;
+        }
+
+        /**
+         * Splits `paths` into batches and runs `batch(first_path, n_paths, rng, acc)` for each, using
+         * settings.threads workers. Each batch owns a disjoint RNG stream and accumulator.
+         * `first_batch` continues an earlier run: its batches are numbered from there, so paths and
+         * streams carry on where that run stopped.
+         */
+        template<typename Accumulator, typename BatchFunc>
+        static Accumulator runBatches(size_t paths, const MonteCarloSettings& settings, BatchFunc&& batch,
+                                      size_t first_batch = 0) {
+            const size_t batch_size = std::max<size_t>(settings.paths_per_batch, 1);
+            const size_t n_batches = (paths + batch_size - 1) / batch_size;
+
+            const StreamFactory streams(settings.seed);
+            std::vector<Accumulator> partial(n_batches);
+            std::atomic<size_t> next_batch{0};
+            std::exception_ptr error;
+            std::mutex error_mutex;
+
+            auto worker = [&]() {
+                try {
+                    for (size_t b = next_batch.fetch_add(1, std::memory_order_relaxed); b < n_batches;
+                         b = next_batch.fetch_add(1, std::memory_order_relaxed)) {
+                        size_t n = std::min(batch_size, paths - b * batch_size);
+                        Xoshiro256 rng = streams.stream(first_batch + b);
+                        batch((first_batch + b) * batch_size, n, rng, partial[b]);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error) error = std::current_exception();
+                    next_batch.store(n_batches, std::memory_order_relaxed);
+                }
+            };
+
+            const size_t n_threads = std::min(resolveThreads(settings.threads), n_batches);
+            if (n_threads <= 1) {
+                worker();
+            } else {
+                // The other workers run on the library pool; the calling thread works too and then
+                // helps with queued tasks until they finish (safe when called from a pool task).
+                ThreadPool& pool = ThreadPool::global();
+                std::atomic<size_t> running{n_threads - 1};
+                for (size_t t = 1; t < n_threads; ++t) {
+                    pool.execute([&worker, &running]() {
+                        worker();
+                        running.fetch_sub(1, std::memory_order_release);
+                    });
+                }
+                worker();
+                pool.helpUntil([&running]() { return running.load(std::memory_order_acquire) == 0; });
+            }
+
+            if (error) std::rethrow_exception(error);
+
+            Accumulator total;
+            for (const auto& p : partial) total.merge(p);
+            return total;
+        }
+
+        // Early-stop conditions of an asynchronous run, checked between batches of paths.
+        struct RunControl {
+            std::stop_token stop;
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+            std::optional<StopReason> check() const {
+                if (stop.stop_requested()) return StopReason::Cancelled;
+                if (deadline != std::chrono::steady_clock::time_point::max() &&
+                    std::chrono::steady_clock::now() >= deadline) return StopReason::Deadline;
+                return std::nullopt;
+            }
+        };
+
+        /**
+         * Mean shift of the terminal normal for `sampling` in the market $S_T = S_0 e^{drift + diff z}$.
+         * The automatic shift is the mean of z conditioned on S_T lying in the payoff region; payoffs
+         * without a region (see RegionPayOff) cannot use it.
+         */
+        template<typename PayoffType>
+        static double importanceShift(const PayoffType& payoff, double S0, double drift, double diff,
+                                      const ImportanceSampling& sampling) {
+            if (!sampling.automatic) return sampling.shift;
+            if constexpr (RegionPayOff<PayoffType>) {
+                if (!(diff > 0.0)) return 0.0;
+                const auto [lower, upper] = payoff.payoffRegion();
+                auto boundary = [&](double spot) { return (std::log(spot / S0) - drift) / diff; };
+                return truncatedNormalMean(boundary(lower), boundary(upper));
+            } else {
+                throw std::invalid_argument("Automatic importance sampling needs a payoff with a payoffRegion()");
+            }
+        }
+
+        // Likelihood ratio $\phi(x) / \phi(x - \mu)$ of a draw x = z + mu (1 without a shift).
+        static double importanceWeight(double mu, double x) {
+            return mu != 0.0 ? std::exp(mu * (0.5 * mu - x)) : 1.0;
+        }
+
+        // Core engine that pushes results to a Gatherer. Stops early, between blocks of
+        // kNormalBlock paths, when `control` says so; returns the paths simulated and why it stopped.
         template<typename PayoffType, StatisticsGatherer GathererType>
-        static void runSimulation(double S0, const Parameters& r, const Parameters& sigma, double T, 
+        static MonteCarloRunResult runSimulation(double S0, const Parameters& r, const Parameters& sigma, double T, 
                                   size_t paths, const PayoffType& payoff, GathererType& gatherer,
                                   std::function<void(double current_price, double current_stderr, size_t paths_done)> on_progress = nullptr,
-                                  size_t progress_interval = 1000) {
+                                  size_t progress_interval = 1000,
+                                  const RunControl& control = {},
+                                  const ImportanceSampling& sampling = {}) {
             
             double r_integral = r.integral(0.0, T);
             double vol_sq_integral = sigma.integralSquare(0.0, T);
@@ -72,86 +872,1256 @@ namespace GreekCore {
             double drift = r_integral - 0.5 * vol_sq_integral;
             double diff = std::sqrt(vol_sq_integral);
             double df = std::exp(-r_integral);
+            const double mu = importanceShift(payoff, S0, drift, diff, sampling);
             
-            Xoshiro256 local_rng(42); 
+            NormalBatchGenerator normals(Xoshiro256(42));
+            std::array<double, kNormalBlock> z;
+
+            for (size_t block_start = 0; block_start < paths; block_start += kNormalBlock) {
+                if (auto stop = control.check()) return {0.0, 0.0, block_start, *stop};
+                const size_t block = std::min(kNormalBlock, paths - block_start);
+                normals.fill(std::span<double>(z.data(), block));
+
+                for (size_t k = 0; k < block; ++k) {
+                    const double x = z[k] + mu;
+                    double ST = S0 * std::exp(drift + diff * x);
+                    double val = payoff(ST) * importanceWeight(mu, x);
+
+                    gatherer.dumpOneResult(val * df);
+
+                    // Report Progress
+                    const size_t i = block_start + k;
+                    // Allocation-free for a SnapshotGatherer.
+                    if (on_progress && (i + 1) % progress_interval == 0) {
+                        GathererSnapshot snap;
+                        takeSnapshot(gatherer, snap);
+                        on_progress(snap.mean, snap.std_error, i + 1);
+                    }
+                }
+            }
+            return {0.0, 0.0, paths, StopReason::MaxPaths};
+        }
+
+        // Fills price and error of a finished run from the gatherer.
+        template<StatisticsGatherer GathererType>
+        static MonteCarloRunResult completeRun(MonteCarloRunResult run, const GathererType& gatherer) {
+            GathererSnapshot snap;
+            takeSnapshot(gatherer, snap);
+            run.price = snap.mean;
+            run.error_estimate = snap.std_error;
+            return run;
+        }
+
+        // Discounted path values of consecutive batches, concatenated in batch order.
+        struct PathValues {
+            std::vector<double> values;
+            void merge(const PathValues& other) { values.insert(values.end(), other.values.begin(), other.values.end()); }
+        };
+
+        // Discounted payoffs of one batch of terminal-spot paths (and their antithetic pairs).
+        template<typename PayoffType>
+        static void simulateTerminalValues(double S0, double drift, double diff, double df, double mu, const PayoffType& payoff,
+                                           const MonteCarloSettings& settings, size_t first_path, size_t n,
+                                           Xoshiro256& rng, PathValues& acc) {
+            PathNormals normals(settings, 1, first_path, rng);
+            std::array<double, kNormalBlock> z;
+            acc.values.reserve(n);
+
+            for (size_t block_start = 0; block_start < n; block_start += kNormalBlock) {
+                const size_t block = std::min(kNormalBlock, n - block_start);
+                normals.fill(std::span<double>(z.data(), block));
+
+                for (size_t k = 0; k < block; ++k) {
+                    const double x = z[k] + mu;
+                    double value = payoff(S0 * std::exp(drift + diff * x)) * importanceWeight(mu, x);
+                    if (settings.antithetic) {
+                        const double x_anti = mu - z[k];
+                        value = 0.5 * (value + payoff(S0 * std::exp(drift + diff * x_anti)) * importanceWeight(mu, x_anti));
+                    }
+                    acc.values.push_back(value * df);
+                }
+            }
+        }
+
+        // Completion state shared by the batch tasks of one asyncEngine() call.
+        template<typename GathererType>
+        struct AsyncJob {
+            GathererType& gatherer;
+            std::promise<MonteCarloRunResult> done;
+            std::mutex mutex;
+            std::vector<std::optional<PathValues>> finished; // batches waiting for their predecessors
+            size_t next_to_gather = 0;
+            size_t gathered_paths = 0;
+            size_t pending;                 // tasks not finished yet
+            size_t first_skipped;           // first batch skipped by a stop request or the deadline
+            std::optional<StopReason> stopped;
+            bool failed = false;
+
+            AsyncJob(GathererType& g, size_t n_batches)
+                : gatherer(g), finished(n_batches), pending(n_batches), first_skipped(n_batches) {}
+        };
+
+        /**
+         * Submits one pool task per batch (same batches and streams as priceEuropean). A finished
+         * batch is fed to the gatherer under the job mutex as soon as all earlier batches have
+         * been, so the gatherer sees the paths in order (any gatherer, thread-safe or not) and only
+         * out-of-order batches are held in memory. Each task checks `control` before simulating;
+         * after a stop the gatherer holds exactly the batches before the first skipped one.
+         */
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static std::future<MonteCarloRunResult> asyncEngine(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                            size_t paths, const PayoffType& payoff, GathererType& gatherer,
+                                                            const MonteCarloSettings& settings, ThreadPool& pool,
+                                                            const RunControl& control) {
+            const double r_integral = r.integral(0.0, T);
+            const double vol_sq_integral = sigma.integralSquare(0.0, T);
+            const double drift = r_integral - 0.5 * vol_sq_integral;
+            const double diff = std::sqrt(vol_sq_integral);
+            const double df = std::exp(-r_integral);
+            const double mu = importanceShift(payoff, S0, drift, diff, settings.importance_sampling);
+
+            const size_t batch_size = std::max<size_t>(settings.paths_per_batch, 1);
+            const size_t n_batches = (paths + batch_size - 1) / batch_size;
+
+            auto job = std::make_shared<AsyncJob<GathererType>>(gatherer, n_batches);
+            std::future<MonteCarloRunResult> result = job->done.get_future();
+            if (n_batches == 0) {
+                job->done.set_value(completeRun({0.0, 0.0, 0, StopReason::MaxPaths}, gatherer));
+                return result;
+            }
+
+            const StreamFactory streams(settings.seed);
+            for (size_t b = 0; b < n_batches; ++b) {
+                const size_t n = std::min(batch_size, paths - b * batch_size);
+                pool.execute([=, rng = streams.stream(b)]() mutable {
+                    const std::optional<StopReason> stop = control.check();
+                    PathValues values;
+                    std::exception_ptr error;
+                    if (!stop) {
+                        try {
+                            simulateTerminalValues(S0, drift, diff, df, mu, payoff, settings, b * batch_size, n, rng, values);
+                        } catch (...) {
+                            error = std::current_exception();
+                        }
+                    }
+
+                    std::lock_guard<std::mutex> lock(job->mutex);
+                    --job->pending;
+                    if (job->failed) return;
+                    try {
+                        if (error) std::rethrow_exception(error);
+                        if (stop) {
+                            if (b < job->first_skipped) {
+                                job->first_skipped = b;
+                                job->stopped = stop;
+                            }
+                        } else if (b < job->first_skipped) {
+                            job->finished[b] = std::move(values);
+                        }
+                        while (job->next_to_gather < job->first_skipped && job->finished[job->next_to_gather]) {
+                            for (double value : job->finished[job->next_to_gather]->values) job->gatherer.dumpOneResult(value);
+                            job->gathered_paths += job->finished[job->next_to_gather]->values.size();
+                            job->finished[job->next_to_gather].reset();
+                            ++job->next_to_gather;
+                        }
+                        if (job->pending == 0) {
+                            job->done.set_value(completeRun({0.0, 0.0, job->gathered_paths,
+                                                             job->stopped.value_or(StopReason::MaxPaths)}, job->gatherer));
+                        }
+                    } catch (...) {
+                        job->failed = true;
+                        job->done.set_exception(std::current_exception());
+                    }
+                });
+            }
+            return result;
+        }
+
+        /**
+         * Simulates rounds of settings.threads batches (same batches and streams as priceEuropean)
+         * and feeds the discounted values to the gatherer in path order; after each round the
+         * stopping rule is checked against the gatherer's [mean, standard error].
+         */
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static MonteCarloToleranceResult toleranceEngine(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                         const PayoffType& payoff, GathererType& gatherer,
+                                                         const ToleranceSettings& tolerance, const MonteCarloSettings& settings) {
+            const double r_integral = r.integral(0.0, T);
+            const double vol_sq_integral = sigma.integralSquare(0.0, T);
+            const double drift = r_integral - 0.5 * vol_sq_integral;
+            const double diff = std::sqrt(vol_sq_integral);
+            const double df = std::exp(-r_integral);
+            const double mu = importanceShift(payoff, S0, drift, diff, settings.importance_sampling);
+
+            const size_t batch_size = std::max<size_t>(settings.paths_per_batch, 1);
+            const size_t round_batches = resolveThreads(settings.threads);
+
+            MonteCarloToleranceResult result{0.0, 0.0, 0, StopReason::MaxPaths};
+            size_t next_batch = 0;
+            while (true) {
+                const size_t round_paths = std::min(round_batches * batch_size, tolerance.max_paths - result.paths);
+                PathValues round = runBatches<PathValues>(round_paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, PathValues& acc) {
+                    simulateTerminalValues(S0, drift, diff, df, mu, payoff, settings, first_path, n, rng, acc);
+                }, next_batch);
+
+                for (double value : round.values) gatherer.dumpOneResult(value);
+                result.paths += round_paths;
+                next_batch += round_batches;
+
+                GathererSnapshot so_far;
+                takeSnapshot(gatherer, so_far);
+                result.price = so_far.mean;
+                result.error_estimate = so_far.std_error;
+
+                if (result.paths >= tolerance.min_paths && result.error_estimate <= tolerance.tolerance) {
+                    result.stop_reason = StopReason::Tolerance;
+                    break;
+                }
+                if (result.paths >= tolerance.max_paths) {
+                    result.stop_reason = StopReason::MaxPaths;
+                    break;
+                }
+                if (std::chrono::steady_clock::now() >= tolerance.deadline) {
+                    result.stop_reason = StopReason::Deadline;
+                    break;
+                }
+                if (tolerance.stop.stop_requested()) {
+                    result.stop_reason = StopReason::Cancelled;
+                    break;
+                }
+            }
+            return result;
+        }
+
+        // One market of a Greek calculation; see greekScenarios().
+        struct Scenario {
+            double S0;
+            Parameters r;
+            Parameters sigma;
+            double T;
+        };
+
+        // Position of each bumped market in the scenario list.
+        enum ScenarioIndex : size_t { Base, SpotUp, SpotDown, VolUp, VolDown, RateUp, RateDown, ThetaShift, kMaxScenarios };
+
+        // Bump sizes of the finite-difference Greeks.
+        static constexpr double kSpotBump = 0.01;          // relative
+        static constexpr double kVolBump = 0.01;
+        static constexpr double kRateBump = 0.0001;
+        static constexpr double kThetaBump = 1.0 / 365.0;
+
+        // Per-path pathwise / likelihood-ratio Greek samples of the base market.
+        struct EstimatorAccumulator {
+            PathAccumulator delta;
+            PathAccumulator gamma;
+            PathAccumulator vega;
+            PathAccumulator rho;
+
+            void merge(const EstimatorAccumulator& other) {
+                delta.merge(other.delta);
+                gamma.merge(other.gamma);
+                vega.merge(other.vega);
+                rho.merge(other.rho);
+            }
+        };
+
+        // Per-scenario accumulators of one batch, merged scenario by scenario.
+        template<typename Accumulator>
+        struct ScenarioAccumulators {
+            std::array<Accumulator, kMaxScenarios> scenario;
+            EstimatorAccumulator estimators;
+
+            void merge(const ScenarioAccumulators& other) {
+                for (size_t s = 0; s < kMaxScenarios; ++s) scenario[s].merge(other.scenario[s]);
+                estimators.merge(other.estimators);
+            }
+        };
+
+        /**
+         * Greek estimators of a European payoff for one normal draw z, with S_T = S0 exp(drift + diff z),
+         * diff^2 = integral of sigma^2 over [0, T]. Derivatives are taken with respect to S0 and to
+         * parallel shifts of a flat volatility and rate, as the finite-difference bumps.
+         *
+         * Pathwise: delta = df f'(S_T) S_T / S0, vega = df f'(S_T) S_T (sqrt(T) z - sigma T),
+         *           rho = T df (f'(S_T) S_T - f(S_T)), gamma = delta (z / diff - 1) / S0 (pathwise-LR mix).
+         * Likelihood ratio: weights z / (S0 diff), (z^2 - z diff - 1) / (S0 diff)^2,
+         *           (z^2 - 1) / sigma - z sqrt(T) and T (z / diff - 1) applied to df f(S_T).
+         */
+        template<typename PayoffType>
+        static std::array<double, 4> greekEstimatorSample(const PayoffType& payoff, double S0, double ST, double z,
+                                                          double diff, double df, double T) {
+            constexpr GreekEstimator estimator = greekEstimatorOf<PayoffType>;
+            const double sigma = diff / std::sqrt(T);
+            const double sqrt_T = std::sqrt(T);
+
+            if constexpr (estimator == GreekEstimator::Pathwise) {
+                const double dV = df * payoff.derivative(ST) * ST;
+                const double delta = dV / S0;
+                return {delta,
+                        delta * (z / diff - 1.0) / S0,
+                        dV * (sqrt_T * z - sigma * T),
+                        T * (dV - df * payoff(ST))};
+            } else {
+                const double value = df * payoff(ST);
+                return {value * z / (S0 * diff),
+                        value * (z * z - z * diff - 1.0) / (S0 * S0 * diff * diff),
+                        value * ((z * z - 1.0) / sigma - z * sqrt_T),
+                        value * T * (z / diff - 1.0)};
+            }
+        }
+
+        static std::vector<Scenario> greekScenarios(double S0, const Parameters& r, const Parameters& sigma, double T) {
+            // Note: Currently Parameters does not support "bumping" a curve easily without re-construction.
+            // For simple sensitivity, we assume Parallel Shift.
+            const double dS = S0 * kSpotBump;
+            const double vol = sigma.rootMeanSquare(0, T);
+            const double rate = r.mean(0, T);
 
-            // Using Box-Muller for consistency with previous implementation
-            for (size_t i = 0; i < paths; ++i) {
-                double u1 = Xoshiro256::to_double(local_rng());
-                if (u1 < 1e-9) u1 = 1e-9;
-                double u2 = Xoshiro256::to_double(local_rng());
-                
-                double R = std::sqrt(-2.0 * std::log(u1));
-                double theta_bm = 2.0 * std::numbers::pi * u2;
-                double z = R * std::cos(theta_bm);
-                
-                double ST = S0 * std::exp(drift + diff * z);
-                double val = payoff(ST);
+            std::vector<Scenario> scenarios;
+            scenarios.reserve(kMaxScenarios);
+            scenarios.push_back({S0, r, sigma, T});
+            scenarios.push_back({S0 + dS, r, sigma, T});
+            scenarios.push_back({S0 - dS, r, sigma, T});
+            scenarios.push_back({S0, r, Parameters(vol + kVolBump), T}); // Simplify for now: treat as const bump
+            scenarios.push_back({S0, r, Parameters(vol - kVolBump), T});
+            scenarios.push_back({S0, Parameters(rate + kRateBump), sigma, T});
+            scenarios.push_back({S0, Parameters(rate - kRateBump), sigma, T});
+            if (T > kThetaBump) scenarios.push_back({S0, r, sigma, T - kThetaBump});
+            return scenarios;
+        }
 
-                gatherer.dumpOneResult(val * df);
+        /**
+         * Prices the base market and the bumped markets of greekScenarios() with
+         * `pricer_func(std::span<const Scenario>) -> std::vector<SimResult>` and takes finite differences.
+         * In GreeksMode::SinglePass all scenarios go through one call (one set of draws); otherwise
+         * each scenario is priced by its own call. Both use the same normals for every scenario.
+         */
+        template<typename Func>
+        static MonteCarloResult calculateWithGreeks(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                    const MonteCarloSettings& settings, Func pricer_func) {
+            const std::vector<Scenario> scenarios = greekScenarios(S0, r, sigma, T);
 
-                // Report Progress
-                if (on_progress && (i + 1) % progress_interval == 0) {
-                    auto res = gatherer.getResultsSoFar(); 
-                    if (!res.empty() && !res[0].empty()) {
-                        on_progress(res[0][0], res.size() > 1 && !res[1].empty() ? res[1][0] : 0.0, i + 1);
-                    }
+            std::vector<SimResult> results;
+            if (settings.greeks == GreeksMode::SinglePass) {
+                results = pricer_func(std::span<const Scenario>(scenarios));
+            } else {
+                for (const auto& scenario : scenarios) {
+                    results.push_back(pricer_func(std::span<const Scenario>(&scenario, 1)).front());
                 }
             }
-        }
 
-        template<typename Func>
-        static MonteCarloResult calculateWithGreeks(double S0, const Parameters& r, const Parameters& sigma, double T, Func pricer_func) {
             // Base Price
-            SimResult base_res = pricer_func(S0, r, sigma, T);
-            double price = base_res.price;
-            double error_est = base_res.std_err;
+            double price = results[Base].price;
+            double error_est = results[Base].std_err;
             
             // Finite Differences for Greeks
-            double dS = S0 * 0.01;
-            double P_up = pricer_func(S0 + dS, r, sigma, T).price;
-            double P_down = pricer_func(S0 - dS, r, sigma, T).price;
+            double dS = S0 * kSpotBump;
+            double P_up = results[SpotUp].price;
+            double P_down = results[SpotDown].price;
             double delta = (P_up - P_down) / (2.0 * dS);
             double gamma = (P_up - 2.0 * price + P_down) / (dS * dS);
             
-            // Vega (Bump Sigma)
-            // Note: Currently Parameters does not support "bumping" a curve easily without re-construction.
-            // For simple sensitivity, we assume Parallel Shift.
-            double dSigma = 0.01; 
-            Parameters sigma_up = Parameters(sigma.rootMeanSquare(0, T) + dSigma); // Simplify for now: treat as const bump
-            Parameters sigma_down = Parameters(sigma.rootMeanSquare(0, T) - dSigma);
-
-            double P_vol_up = pricer_func(S0, r, sigma_up, T).price;
-            double P_vol_down = pricer_func(S0, r, sigma_down, T).price;
-            double vega = (P_vol_up - P_vol_down) / (2.0 * dSigma); 
-            
-            double dR = 0.0001; 
-            Parameters r_up = Parameters(r.mean(0, T) + dR);
-            Parameters r_down = Parameters(r.mean(0, T) - dR);
-            double P_rho_up = pricer_func(S0, r_up, sigma, T).price;
-            double P_rho_down = pricer_func(S0, r_down, sigma, T).price;
-            double rho = (P_rho_up - P_rho_down) / (2.0 * dR);
+            double vega = (results[VolUp].price - results[VolDown].price) / (2.0 * kVolBump); 
+            double rho = (results[RateUp].price - results[RateDown].price) / (2.0 * kRateBump);
             
-            double dT = 1.0 / 365.0; 
             double theta_val = 0.0;
-            if (T > dT) {
-                double P_theta = pricer_func(S0, r, sigma, T - dT).price;
-                theta_val = (P_theta - price) / dT; 
+            if (results.size() > ThetaShift) {
+                theta_val = (results[ThetaShift].price - price) / kThetaBump; 
             }
 
             return {price, delta, gamma, theta_val, vega, rho, error_est, 0.0};
         }
 
+        template<typename PayoffType, typename ControlType>
+        static MonteCarloResult europeanEngine(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                               size_t paths, const PayoffType& payoff, const ControlType& control,
+                                               const MonteCarloSettings& settings) {
+            constexpr bool has_control = !std::is_same_v<ControlType, NoControl>;
+            constexpr bool has_estimator = greekEstimatorOf<PayoffType> != GreekEstimator::FiniteDifference;
+            using Accumulator = std::conditional_t<has_control, ControlAccumulator, PathAccumulator>;
+
+            // One shift for every scenario (from the base market), so bumped prices share their draws and weights.
+            const double r_base = r.integral(0.0, T);
+            const double var_base = sigma.integralSquare(0.0, T);
+            const double mu = importanceShift(payoff, S0, r_base - 0.5 * var_base, std::sqrt(var_base), settings.importance_sampling);
+
+            // `estimators`: if set, also accumulates the Greek estimators of scenarios[0] into it.
+            auto engine_logic = [&](std::span<const Scenario> scenarios, EstimatorAccumulator* estimators) -> std::vector<SimResult> {
+                struct Market {
+                    double S0;
+                    double drift;
+                    double diff;
+                    double df;
+                };
+                const size_t n_scenarios = scenarios.size();
+                std::array<Market, kMaxScenarios> markets;
+                for (size_t s = 0; s < n_scenarios; ++s) {
+                    double r_integral = scenarios[s].r.integral(0.0, scenarios[s].T);
+                    double vol_sq_integral = scenarios[s].sigma.integralSquare(0.0, scenarios[s].T);
+
+                    markets[s] = {scenarios[s].S0, r_integral - 0.5 * vol_sq_integral,
+                                  std::sqrt(vol_sq_integral), std::exp(-r_integral)};
+                }
+
+                using Accumulators = ScenarioAccumulators<Accumulator>;
+                Accumulators total = runBatches<Accumulators>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, Accumulators& acc) {
+                    PathNormals normals(settings, 1, first_path, rng);
+                    std::array<double, kNormalBlock> z;
+
+                    for (size_t block_start = 0; block_start < n; block_start += kNormalBlock) {
+                        const size_t block = std::min(kNormalBlock, n - block_start);
+                        normals.fill(std::span<double>(z.data(), block));
+
+                        for (size_t k = 0; k < block; ++k) {
+                            const double x = z[k] + mu;
+                            const double x_anti = mu - z[k];
+                            const double w = importanceWeight(mu, x);
+                            const double w_anti = settings.antithetic ? importanceWeight(mu, x_anti) : 0.0;
+
+                            for (size_t s = 0; s < n_scenarios; ++s) {
+                                const Market& m = markets[s];
+                                double ST = m.S0 * std::exp(m.drift + m.diff * x);
+                                double value = payoff(ST) * w;
+                                [[maybe_unused]] double control_value = 0.0;
+                                if constexpr (has_control) control_value = control.payoff(ST) * w;
+
+                                if (settings.antithetic) {
+                                    double ST_anti = m.S0 * std::exp(m.drift + m.diff * x_anti);
+                                    value = 0.5 * (value + payoff(ST_anti) * w_anti);
+                                    if constexpr (has_control) control_value = 0.5 * (control_value + control.payoff(ST_anti) * w_anti);
+                                }
+
+                                if constexpr (has_control) {
+                                    acc.scenario[s].add(value * m.df, control_value * m.df);
+                                } else {
+                                    acc.scenario[s].add(value * m.df);
+                                }
+                            }
+
+                            if constexpr (has_estimator) {
+                                if (estimators) {
+                                    const Market& m = markets[0];
+                                    const double T_base = scenarios[0].T;
+                                    double ST = m.S0 * std::exp(m.drift + m.diff * x);
+                                    auto g = greekEstimatorSample(payoff, m.S0, ST, x, m.diff, m.df, T_base);
+                                    for (double& gi : g) gi *= w;
+                                    if (settings.antithetic) {
+                                        double ST_anti = m.S0 * std::exp(m.drift + m.diff * x_anti);
+                                        auto g_anti = greekEstimatorSample(payoff, m.S0, ST_anti, x_anti, m.diff, m.df, T_base);
+                                        for (size_t i = 0; i < g.size(); ++i) g[i] = 0.5 * (g[i] + g_anti[i] * w_anti);
+                                    }
+                                    acc.estimators.delta.add(g[0]);
+                                    acc.estimators.gamma.add(g[1]);
+                                    acc.estimators.vega.add(g[2]);
+                                    acc.estimators.rho.add(g[3]);
+                                }
+                            }
+                        }
+                    }
+                });
+                if (estimators) *estimators = total.estimators;
+
+                std::vector<SimResult> results(n_scenarios);
+                for (size_t s = 0; s < n_scenarios; ++s) {
+                    if constexpr (has_control) {
+                        const Scenario& sc = scenarios[s];
+                        results[s] = total.scenario[s].result(1.0, control.expectation(sc.S0, sc.r, sc.sigma, sc.T));
+                    } else {
+                        results[s] = total.scenario[s].result(1.0);
+                    }
+                }
+                return results;
+            };
+
+            if constexpr (has_estimator) {
+                if (settings.greeks == GreeksMode::Estimators && T > 0.0 && sigma.integralSquare(0.0, T) > 0.0) {
+                    std::vector<Scenario> scenarios;
+                    scenarios.push_back({S0, r, sigma, T});
+                    if (T > kThetaBump) scenarios.push_back({S0, r, sigma, T - kThetaBump});
+
+                    EstimatorAccumulator estimators;
+                    std::vector<SimResult> results = engine_logic(scenarios, &estimators);
+
+                    double price = results[Base].price;
+                    double theta_val = (results.size() > 1) ? (results[1].price - price) / kThetaBump : 0.0;
+                    return {price,
+                            estimators.delta.result(1.0).price,
+                            estimators.gamma.result(1.0).price,
+                            theta_val,
+                            estimators.vega.result(1.0).price,
+                            estimators.rho.result(1.0).price,
+                            results[Base].std_err, 0.0};
+                }
+            }
+
+            return calculateWithGreeks(S0, r, sigma, T, settings, [&](std::span<const Scenario> scenarios) {
+                return engine_logic(scenarios, nullptr);
+            });
+        }
+
+        // One market of a path-dependent simulation, on the scenario's own grid.
+        struct PathMarket {
+            double S0;
+            TimeGrid grid;
+            DriftDiffusionTable table;
+        };
+
+        /**
+         * Structure-of-arrays variant of pathDependentEngine's path loop (MonteCarloSettings::path_block):
+         * each block of paths is advanced one time step at a time through lognormalStep(), so the
+         * inner loop is a contiguous vectorized exp over the block instead of a serial chain per path.
+         * Normals are drawn path by path exactly as in the scalar loop and then transposed. With
+         * Real = float (Precision::Float) the normals and spots are single precision.
+         */
+        template<typename Real, typename PayoffType, typename ControlType, typename Accumulators>
+        static void simulatePathBlocks(std::span<const PathMarket> markets, PathNormals& normals, size_t n,
+                                       const PayoffType& payoff, const ControlType& control,
+                                       const MonteCarloSettings& settings, Accumulators& acc) {
+            constexpr bool has_control = !std::is_same_v<ControlType, NoControl>;
+            const size_t steps = markets.front().grid.size();
+            const size_t block = std::min(settings.path_block, n);
+            const size_t anti_block = settings.antithetic ? block : 0;
+
+            // Normals are transposed kTransposeTile paths at a time, so each row write fills a cache line.
+            constexpr size_t kTransposeTile = 8;
+            std::vector<Real> z(kTransposeTile * steps);
+            std::vector<Real> z_block(steps * block); // z_block[j * block + k]: normal of path k at step j
+            std::vector<Real> spot(block);
+            std::vector<Real> spot_anti(anti_block);
+
+            detail::BlockPathEvaluator<PayoffType> eval(payoff, steps, block);
+            detail::BlockPathEvaluator<PayoffType> eval_anti(payoff, steps, anti_block);
+            [[maybe_unused]] auto control_eval = makeBlockControlEvaluator(control, steps, block);
+            [[maybe_unused]] auto control_eval_anti = makeBlockControlEvaluator(control, steps, anti_block);
+
+            for (size_t block_start = 0; block_start < n; block_start += block) {
+                const size_t b = std::min(block, n - block_start);
+                for (size_t k0 = 0; k0 < b; k0 += kTransposeTile) {
+                    const size_t tile = std::min(kTransposeTile, b - k0);
+                    for (size_t t = 0; t < tile; ++t) normals.fill(std::span<Real>(z.data() + t * steps, steps));
+                    for (size_t j = 0; j < steps; ++j) {
+                        for (size_t t = 0; t < tile; ++t) z_block[j * block + k0 + t] = z[t * steps + j];
+                    }
+                }
+
+                for (size_t s = 0; s < markets.size(); ++s) {
+                    const PathMarket& m = markets[s];
+                    const double* drift = m.table.drift().data();
+                    const double* diff = m.table.diffusion().data();
+                    const double* times = m.grid.times().data();
+                    const std::span<Real> S(spot.data(), b);
+                    const std::span<Real> S_anti(spot_anti.data(), settings.antithetic ? b : 0);
+
+                    std::fill(S.begin(), S.end(), static_cast<Real>(m.S0));
+                    std::fill(S_anti.begin(), S_anti.end(), static_cast<Real>(m.S0));
+                    eval.begin(S);
+                    if constexpr (has_control) control_eval.begin(S);
+                    if (settings.antithetic) {
+                        eval_anti.begin(S_anti);
+                        if constexpr (has_control) control_eval_anti.begin(S_anti);
+                    }
+
+                    for (size_t j = 0; j < steps; ++j) {
+                        const std::span<const Real> z_step(z_block.data() + j * block, b);
+                        const double variance = diff[j] * diff[j];
+                        lognormalStep(S, z_step, static_cast<Real>(drift[j]), static_cast<Real>(diff[j]));
+                        eval.observe(j, times[j], S, variance);
+                        if constexpr (has_control) control_eval.observe(j, times[j], S, variance);
+
+                        if (settings.antithetic) {
+                            lognormalStep(S_anti, z_step, static_cast<Real>(drift[j]), static_cast<Real>(-diff[j]));
+                            eval_anti.observe(j, times[j], S_anti, variance);
+                            if constexpr (has_control) control_eval_anti.observe(j, times[j], S_anti, variance);
+                        }
+                    }
+
+                    for (size_t k = 0; k < b; ++k) {
+                        double value = eval.finish(k);
+                        [[maybe_unused]] double control_value = 0.0;
+                        if constexpr (has_control) control_value = control_eval.finish(k);
+
+                        if (settings.antithetic) {
+                            value = 0.5 * (value + eval_anti.finish(k));
+                            if constexpr (has_control) control_value = 0.5 * (control_value + control_eval_anti.finish(k));
+                        }
+
+                        if constexpr (has_control) {
+                            acc.scenario[s].add(value, control_value);
+                        } else {
+                            acc.scenario[s].add(value);
+                        }
+                    }
+                }
+            }
+        }
+
+        template<typename PayoffType, typename ControlType>
+        static MonteCarloResult pathDependentEngine(double S0, const Parameters& r, const Parameters& sigma, const TimeGrid& grid,
+                                                    size_t paths, const PayoffType& payoff,
+                                                    const ControlType& control, const MonteCarloSettings& settings) {
+            constexpr bool has_control = !std::is_same_v<ControlType, NoControl>;
+            using Accumulator = std::conditional_t<has_control, ControlAccumulator, PathAccumulator>;
+            const size_t steps = grid.size();
+
+            auto engine_logic = [&](std::span<const Scenario> scenarios) -> std::vector<SimResult> {
+                const size_t n_scenarios = scenarios.size();
+                std::vector<PathMarket> markets;
+                markets.reserve(n_scenarios);
+                for (const Scenario& sc : scenarios) {
+                    // The theta scenario keeps the grid's relative spacing over its shorter maturity.
+                    TimeGrid scenario_grid = (sc.T == grid.maturity()) ? grid : grid.rescaled(sc.T);
+                    DriftDiffusionTable table(scenario_grid, sc.r, sc.sigma);
+                    markets.push_back({sc.S0, std::move(scenario_grid), std::move(table)});
+                }
+                const BrownianBridge bridge(grid.times());
+
+                using Accumulators = ScenarioAccumulators<Accumulator>;
+                Accumulators total = runBatches<Accumulators>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, Accumulators& acc) {
+                    PathNormals normals(settings, steps, first_path, rng, &bridge);
+                    if (settings.path_block > 1) {
+                        if (settings.precision == Precision::Float) {
+                            simulatePathBlocks<float>(markets, normals, n, payoff, control, settings, acc);
+                        } else {
+                            simulatePathBlocks<double>(markets, normals, n, payoff, control, settings, acc);
+                        }
+                        return;
+                    }
+                    std::vector<double> z(steps);
+
+                    detail::PathEvaluator<PayoffType> eval(payoff, steps);
+                    detail::PathEvaluator<PayoffType> eval_anti(payoff, settings.antithetic ? steps : 0);
+                    [[maybe_unused]] auto control_eval = makeControlEvaluator(control, steps);
+                    [[maybe_unused]] auto control_eval_anti = makeControlEvaluator(control, settings.antithetic ? steps : 0);
+
+                    for (size_t i = 0; i < n; ++i) {
+                        normals.fill(z);
+
+                        for (size_t s = 0; s < n_scenarios; ++s) {
+                            const PathMarket& m = markets[s];
+                            const double* drift = m.table.drift().data();
+                            const double* diff = m.table.diffusion().data();
+                            const double* times = m.grid.times().data();
+                            double current_S = m.S0;
+                            double current_S_anti = m.S0;
+
+                            eval.begin(m.S0);
+                            if constexpr (has_control) control_eval.begin(m.S0);
+                            if (settings.antithetic) {
+                                eval_anti.begin(m.S0);
+                                if constexpr (has_control) control_eval_anti.begin(m.S0);
+                            }
+
+                            for (size_t j = 0; j < steps; ++j) {
+                                const double variance = diff[j] * diff[j];
+                                current_S *= std::exp(drift[j] + diff[j] * z[j]);
+                                eval.observe(j, times[j], current_S, variance);
+                                if constexpr (has_control) control_eval.observe(j, times[j], current_S, variance);
+
+                                if (settings.antithetic) {
+                                    current_S_anti *= std::exp(drift[j] - diff[j] * z[j]);
+                                    eval_anti.observe(j, times[j], current_S_anti, variance);
+                                    if constexpr (has_control) control_eval_anti.observe(j, times[j], current_S_anti, variance);
+                                }
+                            }
+
+                            double value = eval.finish();
+                            [[maybe_unused]] double control_value = 0.0;
+                            if constexpr (has_control) control_value = control_eval.finish();
+
+                            if (settings.antithetic) {
+                                value = 0.5 * (value + eval_anti.finish());
+                                if constexpr (has_control) control_value = 0.5 * (control_value + control_eval_anti.finish());
+                            }
+
+                            if constexpr (has_control) {
+                                acc.scenario[s].add(value, control_value);
+                            } else {
+                                acc.scenario[s].add(value);
+                            }
+                        }
+                    }
+                });
+
+                std::vector<SimResult> results(n_scenarios);
+                for (size_t s = 0; s < n_scenarios; ++s) {
+                    if constexpr (has_control) {
+                        const Scenario& sc = scenarios[s];
+                        results[s] = total.scenario[s].result(markets[s].table.discountFactor(), control.expectation(sc.S0, sc.r, sc.sigma, sc.T));
+                    } else {
+                        results[s] = total.scenario[s].result(markets[s].table.discountFactor());
+                    }
+                }
+                return results;
+            };
+
+            return calculateWithGreeks(S0, r, sigma, grid.maturity(), settings, engine_logic);
+        }
+
+        /**
+         * Simulates one batch of Heston paths with the QE scheme and passes each discounted path
+         * value to `sink`. Each path draws 2 normals per QE step (variance, spot); antithetic
+         * paths negate both.
+         */
+        template<typename PayoffType, typename Sink>
+        static void hestonBatch(double S0, const HestonQEScheme& scheme, const TimeGrid& grid, const PayoffType& payoff,
+                                const MonteCarloSettings& settings, size_t first_path, size_t n, Xoshiro256& rng, Sink&& sink) {
+            static_assert(!StepVarianceObserver<PayoffType>,
+                          "Brownian-bridge payoffs need a deterministic step variance, which Heston paths do not have");
+            const size_t factors = 2 * scheme.steps();
+            PathNormals normals(settings, factors, first_path, rng);
+            std::vector<double> z(factors);
+            detail::PathEvaluator<PayoffType> eval(payoff, grid.size());
+            detail::PathEvaluator<PayoffType> eval_anti(payoff, settings.antithetic ? grid.size() : 0);
+            const double log_S0 = std::log(S0);
+
+            auto simulate = [&](detail::PathEvaluator<PayoffType>& e, double sign) {
+                double log_spot = log_S0;
+                double variance = scheme.initialVariance();
+                size_t k = 0;
+                e.begin(S0);
+                for (size_t j = 0; j < grid.size(); ++j) {
+                    for (size_t s = 0; s < scheme.stepsInInterval(j); ++s, ++k) {
+                        scheme.advance(k, log_spot, variance, sign * z[2 * k], sign * z[2 * k + 1]);
+                    }
+                    e.observe(j, grid[j], std::exp(log_spot), 0.0);
+                }
+                return e.finish();
+            };
+
+            for (size_t i = 0; i < n; ++i) {
+                normals.fill(z);
+                double value = simulate(eval, 1.0);
+                if (settings.antithetic) value = 0.5 * (value + simulate(eval_anti, -1.0));
+                sink(value * scheme.discountFactor());
+            }
+        }
+
+        // Paths advanced together by multiAssetEngine (structure of arrays over the block).
+        static constexpr size_t kAssetBlock = 64;
+
+        /**
+         * Simulates correlated multi-asset paths in blocks of kAssetBlock paths: each step's
+         * independent normals are transposed asset-major, correlated by one block matrix-vector
+         * product with the Cholesky factor and applied to the spots with lognormalStep. Terminal
+         * payoffs get the final spots, path payoffs a MultiAssetPath of the spots at every grid time.
+         */
+        template<typename PayoffType>
+        static MonteCarloRunResult multiAssetEngine(const MultiAssetMarket& market, const TimeGrid& grid, size_t paths,
+                                                    const PayoffType& payoff, const MonteCarloSettings& settings) {
+            constexpr bool path_payoff = MultiAssetPathPayOff<PayoffType>;
+            static_assert(path_payoff || MultiAssetPayOff<PayoffType>,
+                          "priceMultiAsset needs a payoff on std::span<const double> spots or on a MultiAssetPath");
+
+            const size_t n_assets = market.spots.size();
+            if (market.vols.size() != n_assets) throw std::invalid_argument("priceMultiAsset needs one volatility per asset");
+            const CholeskyFactor cholesky(market.correlation, n_assets);
+            const size_t steps = grid.size();
+            const size_t factors = n_assets * steps;
+
+            std::vector<double> drift(factors), diffusion(factors);
+            for (size_t a = 0; a < n_assets; ++a) {
+                const DriftDiffusionTable table(grid, market.r, market.vols[a]);
+                for (size_t j = 0; j < steps; ++j) {
+                    drift[a * steps + j] = table.drift()[j];
+                    diffusion[a * steps + j] = table.diffusion()[j];
+                }
+            }
+            const double df = std::exp(-market.r.integral(0.0, grid.maturity()));
+
+            PathAccumulator total = runBatches<PathAccumulator>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, PathAccumulator& acc) {
+                constexpr size_t B = kAssetBlock;
+                PathNormals normals(settings, factors, first_path, rng);
+                std::vector<double> z(B * factors);
+                std::vector<double> independent(n_assets * B, 0.0), correlated(n_assets * B);
+                std::vector<double> spot(n_assets * B), spot_anti(settings.antithetic ? n_assets * B : 0);
+                std::vector<double> history(path_payoff ? B * factors : 0), history_anti(path_payoff && settings.antithetic ? B * factors : 0);
+                std::vector<double> terminal(n_assets);
+
+                auto record = [&](const std::vector<double>& spots, std::vector<double>& hist, size_t j, size_t b) {
+                    for (size_t p = 0; p < b; ++p) {
+                        for (size_t a = 0; a < n_assets; ++a) hist[(p * steps + j) * n_assets + a] = spots[a * B + p];
+                    }
+                };
+                auto value = [&](const std::vector<double>& spots, const std::vector<double>& hist, size_t p) -> double {
+                    if constexpr (path_payoff) {
+                        return payoff(MultiAssetPath(std::span<const double>(hist.data() + p * factors, factors), n_assets));
+                    } else {
+                        for (size_t a = 0; a < n_assets; ++a) terminal[a] = spots[a * B + p];
+                        return payoff(std::span<const double>(terminal));
+                    }
+                };
+
+                for (size_t block_start = 0; block_start < n; block_start += B) {
+                    const size_t b = std::min(B, n - block_start);
+                    normals.fill(std::span<double>(z.data(), b * factors));
+                    for (size_t a = 0; a < n_assets; ++a) {
+                        std::fill_n(spot.begin() + a * B, B, market.spots[a]);
+                        if (settings.antithetic) std::fill_n(spot_anti.begin() + a * B, B, market.spots[a]);
+                    }
+
+                    for (size_t j = 0; j < steps; ++j) {
+                        for (size_t p = 0; p < b; ++p) {
+                            for (size_t a = 0; a < n_assets; ++a) independent[a * B + p] = z[p * factors + j * n_assets + a];
+                        }
+                        cholesky.multiplyBlock(independent, correlated, B);
+
+                        for (size_t a = 0; a < n_assets; ++a) {
+                            const double mu = drift[a * steps + j], vol = diffusion[a * steps + j];
+                            const std::span<const double> x(correlated.data() + a * B, B);
+                            lognormalStep(std::span<double>(spot.data() + a * B, B), x, mu, vol);
+                            if (settings.antithetic) lognormalStep(std::span<double>(spot_anti.data() + a * B, B), x, mu, -vol);
+                        }
+                        if constexpr (path_payoff) {
+                            record(spot, history, j, b);
+                            if (settings.antithetic) record(spot_anti, history_anti, j, b);
+                        }
+                    }
+
+                    for (size_t p = 0; p < b; ++p) {
+                        double v = value(spot, history, p);
+                        if (settings.antithetic) v = 0.5 * (v + value(spot_anti, history_anti, p));
+                        acc.add(v * df);
+                    }
+                }
+            });
+            const SimResult sim = total.result(1.0);
+            return {sim.price, sim.std_err, paths, StopReason::MaxPaths};
+        }
+
+        // Regression of one exercise date over one batch of paths.
+        struct RegressionAccumulator {
+            LeastSquares fit;
+
+            void merge(const RegressionAccumulator& other) {
+                if (fit.regressors() == 0) fit = other.fit;
+                else fit.merge(other.fit);
+            }
+        };
+
+        // Accumulator of the batch passes that only write per-path state.
+        struct NoStatistics {
+            void merge(const NoStatistics&) {}
+        };
+
+        /**
+         * Longstaff-Schwartz least-squares Monte Carlo for a payoff exercisable at every date of
+         * `grid` (the last one is the maturity).
+         *
+         * Regression pass: for each exercise date, backwards, the discounted value of following
+         * the exercise rule of the later dates is regressed on the basis functions of S / S0 over
+         * the in-the-money paths. The paths are stored as a date-major (structure of arrays) matrix
+         * of the spots at the exercise dates, or regenerated when that matrix exceeds
+         * lsm.memory_budget. Each date's normal equations are accumulated per batch and merged in
+         * batch order, so the coefficients do not depend on settings.threads.
+         *
+         * Pricing pass: independent paths (the batches after the regression ones) follow the
+         * fitted exercise rule. The estimate is biased low by the sub-optimality of the rule only.
+         */
+        template<typename PayoffType>
+        static MonteCarloRunResult earlyExerciseEngine(double S0, const Parameters& r, const Parameters& sigma,
+                                                       const TimeGrid& grid, size_t paths, const PayoffType& payoff,
+                                                       const EarlyExerciseSettings& lsm, const MonteCarloSettings& settings) {
+            static_assert(std::is_invocable_r_v<double, const PayoffType&, double>,
+                          "priceBermudan needs an exercise payoff on the spot");
+            const size_t dates = grid.size();
+            const size_t k = std::max<size_t>(lsm.basis_size, 1);
+            const DriftDiffusionTable table(grid, r, sigma);
+            const double* drift = table.drift().data();
+            const double* diff = table.diffusion().data();
+            const BrownianBridge bridge(grid.times());
+
+            std::vector<double> df(dates);
+            for (size_t j = 0; j < dates; ++j) df[j] = std::exp(-r.integral(0.0, grid[j]));
+
+            // Spots of the next n paths at dates 0..last: out[j * stride + i] for path i.
+            auto simulate = [&](PathNormals& normals, std::vector<double>& z, size_t n, size_t last, double* out, size_t stride) {
+                for (size_t i = 0; i < n; ++i) {
+                    normals.fill(z);
+                    double spot = S0;
+                    for (size_t j = 0; j <= last; ++j) {
+                        spot *= std::exp(drift[j] + diff[j] * z[j]);
+                        out[j * stride + i] = spot;
+                    }
+                }
+            };
+
+            // --- Regression pass ---
+            const size_t regression_paths = lsm.regression_paths > 0 ? lsm.regression_paths : paths;
+            const bool store = lsm.memory_budget == 0 || regression_paths * dates <= lsm.memory_budget / sizeof(double);
+            std::vector<double> matrix(store ? regression_paths * dates : 0); // matrix[j * paths + p]
+            std::vector<double> value(regression_paths);                      // discounted to time 0
+            std::vector<std::vector<double>> beta(dates);
+
+            if (store) {
+                runBatches<NoStatistics>(regression_paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, NoStatistics&) {
+                    PathNormals normals(settings, dates, first_path, rng, &bridge);
+                    std::vector<double> z(dates);
+                    simulate(normals, z, n, dates - 1, matrix.data() + first_path, regression_paths);
+                });
+            }
+
+            // Sweep j applies the fitted rule at date j + 1 (the payoff at maturity when j + 1 is the
+            // last date) and then regresses at date j.
+            for (size_t j = dates - 1; j-- > 0;) {
+                RegressionAccumulator fit = runBatches<RegressionAccumulator>(regression_paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, RegressionAccumulator& acc) {
+                    acc.fit = LeastSquares(k);
+                    std::vector<double> regenerated(store ? 0 : 2 * n), phi(k);
+                    const double* spot_now = matrix.data() + j * regression_paths + first_path;
+                    const double* spot_next = spot_now + regression_paths;
+                    if (!store) {
+                        PathNormals normals(settings, dates, first_path, rng, &bridge);
+                        std::vector<double> z(dates), path((j + 2) * n);
+                        simulate(normals, z, n, j + 1, path.data(), n);
+                        std::copy_n(path.begin() + j * n, 2 * n, regenerated.begin());
+                        spot_now = regenerated.data();
+                        spot_next = spot_now + n;
+                    }
+
+                    for (size_t i = 0; i < n; ++i) {
+                        double& v = value[first_path + i];
+                        const double exercise_next = payoff(spot_next[i]);
+                        if (j + 2 == dates) {
+                            v = df[j + 1] * exercise_next;
+                        } else if (exercise_next > 0.0) {
+                            evaluateBasis(lsm.basis, spot_next[i] / S0, phi);
+                            if (df[j + 1] * exercise_next > std::inner_product(phi.begin(), phi.end(), beta[j + 1].begin(), 0.0)) {
+                                v = df[j + 1] * exercise_next;
+                            }
+                        }
+                        if (payoff(spot_now[i]) > 0.0) {
+                            evaluateBasis(lsm.basis, spot_now[i] / S0, phi);
+                            acc.fit.add(phi, v);
+                        }
+                    }
+                });
+                beta[j] = fit.fit.regressors() == k ? fit.fit.solve() : std::vector<double>(k, 0.0);
+            }
+            matrix = {};
+            value = {};
+
+            // --- Pricing pass ---
+            const size_t batch_size = std::max<size_t>(settings.paths_per_batch, 1);
+            const size_t regression_batches = (regression_paths + batch_size - 1) / batch_size;
+            // first_path already counts the regression batches: quasi-random points continue after theirs.
+            PathAccumulator total = runBatches<PathAccumulator>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, PathAccumulator& acc) {
+                PathNormals normals(settings, dates, first_path, rng, &bridge);
+                std::vector<double> z(dates), phi(k);
+
+                auto exercised = [&](double sign) {
+                    double spot = S0;
+                    for (size_t j = 0; j < dates; ++j) {
+                        spot *= std::exp(drift[j] + sign * diff[j] * z[j]);
+                        const double exercise = payoff(spot);
+                        if (j + 1 == dates) return df[j] * exercise;
+                        if (exercise > 0.0) {
+                            evaluateBasis(lsm.basis, spot / S0, phi);
+                            if (df[j] * exercise > std::inner_product(phi.begin(), phi.end(), beta[j].begin(), 0.0)) {
+                                return df[j] * exercise;
+                            }
+                        }
+                    }
+                    return 0.0;
+                };
+
+                for (size_t i = 0; i < n; ++i) {
+                    normals.fill(z);
+                    double v = exercised(1.0);
+                    if (settings.antithetic) v = 0.5 * (v + exercised(-1.0));
+                    acc.add(v);
+                }
+            }, regression_batches);
+            const SimResult sim = total.result(1.0);
+            return {sim.price, sim.std_err, paths, StopReason::MaxPaths};
+        }
+
+        // One gatherer per batch of a multilevel round, merged in batch order.
+        template<MergeableGatherer GathererType>
+        struct GathererAccumulator {
+            GathererType gatherer;
+
+            void merge(const GathererAccumulator& other) { gatherer.merge(other.gatherer); }
+        };
+
+        /**
+         * Simulates `paths` level corrections on `fine` (batches numbered from `first_batch`): each
+         * path is simulated once on the fine grid and observed by the payoff at every fine time
+         * and, from level 1 on, at every second fine time, i.e. on the coarse grid with the same
+         * Brownian increments. The fine minus coarse values go to the batch's gatherer.
+         */
+        template<typename PayoffType, MergeableGatherer GathererType>
+        static GathererAccumulator<GathererType> multilevelRound(double S0, const PathMarket& fine, bool coarse, size_t paths,
+                                                                 const PayoffType& payoff, const MonteCarloSettings& settings,
+                                                                 size_t first_batch) {
+            const size_t steps = fine.grid.size();
+            const BrownianBridge bridge(fine.grid.times());
+            return runBatches<GathererAccumulator<GathererType>>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, GathererAccumulator<GathererType>& acc) {
+                PathNormals normals(settings, steps, first_path, rng, &bridge);
+                std::vector<double> z(steps);
+                detail::PathEvaluator<PayoffType> eval_fine(payoff, steps);
+                detail::PathEvaluator<PayoffType> eval_coarse(payoff, coarse ? steps / 2 : 0);
+                const double* drift = fine.table.drift().data();
+                const double* diff = fine.table.diffusion().data();
+
+                auto correction = [&](double sign) {
+                    double spot = S0;
+                    double coarse_variance = 0.0; // over the coarse step, i.e. two fine steps
+                    eval_fine.begin(S0);
+                    if (coarse) eval_coarse.begin(S0);
+                    for (size_t j = 0; j < steps; ++j) {
+                        const double variance = diff[j] * diff[j];
+                        spot *= std::exp(drift[j] + sign * diff[j] * z[j]);
+                        eval_fine.observe(j, fine.grid[j], spot, variance);
+                        coarse_variance += variance;
+                        if (coarse && j % 2 == 1) {
+                            eval_coarse.observe(j / 2, fine.grid[j], spot, coarse_variance);
+                            coarse_variance = 0.0;
+                        }
+                    }
+                    return eval_fine.finish() - (coarse ? eval_coarse.finish() : 0.0);
+                };
+
+                for (size_t i = 0; i < n; ++i) {
+                    normals.fill(z);
+                    double y = correction(1.0);
+                    if (settings.antithetic) y = 0.5 * (y + correction(-1.0));
+                    acc.gatherer.dumpOneResult(y * fine.table.discountFactor());
+                }
+            }, first_batch);
+        }
+
+        // Least-squares slope of log2|values[l]| over l = 1, 2, ... (level 0 is not a correction).
+        static double decayOrder(std::span<const double> values) {
+            double sl = 0.0, sy = 0.0, sll = 0.0, sly = 0.0, n = 0.0;
+            for (size_t l = 1; l < values.size(); ++l) {
+                if (!(std::abs(values[l]) > 0.0)) continue;
+                const double y = std::log2(std::abs(values[l]));
+                sl += l; sy += y; sll += double(l) * l; sly += l * y; n += 1.0;
+            }
+            if (n < 2.0) return 0.0;
+            return -(n * sly - sl * sy) / (n * sll - sl * sl);
+        }
+
+        /**
+         * Giles' multilevel driver: simulates pilot paths on min_levels levels, then repeatedly
+         * (a) sets each level's paths to $N_l = 2 \epsilon^{-2} \sqrt{V_l / C_l} \sum_k \sqrt{V_k C_k}$,
+         * which minimizes the cost for a statistical variance of $\epsilon^2 / 2$, and simulates the
+         * missing ones, and (b) once no level needs more, adds a finer level while the bias estimate
+         * $\max(|Y_L|, |Y_{L-1}| 2^{-\alpha}) / (2^\alpha - 1)$ exceeds $\epsilon / \sqrt{2}$.
+         *
+         * Level l draws from its own root stream (seed settings.seed + l) and continues its batch
+         * numbering across rounds, so results are reproducible for any settings.threads.
+         *
+         * @cite Giles, M. B. (2015). "Multilevel Monte Carlo methods". Acta Numerica 24.
+         */
+        template<typename PayoffType, MergeableGatherer GathererType>
+        static MultilevelResult multilevelEngine(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                 const PayoffType& payoff, const MultilevelSettings& mlmc,
+                                                 const MonteCarloSettings& settings) {
+            if (!(mlmc.target_rmse > 0.0)) throw std::invalid_argument("priceMultilevel needs a positive target RMSE");
+            const size_t max_levels = std::max<size_t>(mlmc.max_levels, 1);
+            const size_t batch_size = std::max<size_t>(settings.paths_per_batch, 1);
+            const double eps = mlmc.target_rmse;
+
+            std::vector<PathMarket> markets;
+            std::vector<GathererType> gatherers;
+            std::vector<MultilevelLevel> levels;
+            std::vector<size_t> extra;
+            auto addLevel = [&]() {
+                const size_t l = levels.size();
+                const size_t steps = std::max<size_t>(mlmc.base_steps, 1) << l;
+                TimeGrid grid(T, steps);
+                DriftDiffusionTable table(grid, r, sigma);
+                markets.push_back({S0, std::move(grid), std::move(table)});
+                gatherers.emplace_back();
+                levels.push_back({steps, 0, 0.0, 0.0, static_cast<double>(steps), 0.0});
+                extra.push_back(mlmc.initial_paths);
+            };
+            for (size_t l = 0; l < std::clamp<size_t>(mlmc.min_levels, 1, max_levels); ++l) addLevel();
+
+            double bias = 0.0;
+            bool converged = false;
+            for (;;) {
+                // Simulate the missing paths and refresh the level statistics.
+                for (size_t l = 0; l < levels.size(); ++l) {
+                    if (extra[l] == 0) continue;
+                    MonteCarloSettings level_settings = settings;
+                    level_settings.seed = settings.seed + l;
+                    const size_t first_batch = (levels[l].paths + batch_size - 1) / batch_size;
+                    const auto start = std::chrono::steady_clock::now();
+                    auto round = multilevelRound<PayoffType, GathererType>(S0, markets[l], l > 0, extra[l], payoff, level_settings, first_batch);
+                    levels[l].seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    gatherers[l].merge(round.gatherer);
+                    levels[l].paths += extra[l];
+                    extra[l] = 0;
+
+                    GathererSnapshot snap;
+                    takeSnapshot(gatherers[l], snap);
+                    levels[l].mean = snap.mean;
+                    levels[l].variance = snap.std_error * snap.std_error * static_cast<double>(levels[l].paths);
+                }
+
+                // Decay orders (fixed or fitted) and the variance of a new finest level.
+                std::vector<double> means(levels.size()), variances(levels.size());
+                for (size_t l = 0; l < levels.size(); ++l) {
+                    means[l] = levels[l].mean;
+                    variances[l] = levels[l].variance;
+                }
+                const double alpha = mlmc.weak_order > 0.0 ? mlmc.weak_order : std::max(0.5, decayOrder(means));
+                const double beta = mlmc.variance_order > 0.0 ? mlmc.variance_order : std::max(0.5, decayOrder(variances));
+
+                // Optimal allocation for the current levels.
+                double sum_vc = 0.0;
+                for (const auto& level : levels) sum_vc += std::sqrt(level.variance * level.cost);
+                bool more = false;
+                for (size_t l = 0; l < levels.size(); ++l) {
+                    const double optimal = std::ceil(2.0 / (eps * eps) * std::sqrt(levels[l].variance / levels[l].cost) * sum_vc);
+                    const size_t target = static_cast<size_t>(std::min(optimal, 1e15));
+                    extra[l] = target > levels[l].paths ? target - levels[l].paths : 0;
+                    more = more || extra[l] > levels[l].paths / 100;
+                }
+                if (more) continue;
+
+                // Bias test on the two finest corrections.
+                const size_t L = levels.size() - 1;
+                const double ratio = std::pow(2.0, alpha);
+                bias = std::abs(levels[L].mean);
+                if (L >= 2) bias = std::max(bias, std::abs(levels[L - 1].mean) / ratio);
+                bias /= ratio - 1.0;
+                if (bias <= eps / std::numbers::sqrt2) {
+                    converged = true;
+                    break;
+                }
+                if (levels.size() == max_levels) break;
+
+                addLevel();
+                levels.back().variance = levels[L].variance / std::pow(2.0, beta);
+                extra.back() = 0;
+                sum_vc += std::sqrt(levels.back().variance * levels.back().cost);
+                for (size_t l = 0; l < levels.size(); ++l) {
+                    const double optimal = std::ceil(2.0 / (eps * eps) * std::sqrt(levels[l].variance / levels[l].cost) * sum_vc);
+                    const size_t target = std::max(static_cast<size_t>(std::min(optimal, 1e15)), l == L + 1 ? mlmc.initial_paths : 0);
+                    extra[l] = target > levels[l].paths ? target - levels[l].paths : 0;
+                }
+            }
+
+            MultilevelResult result{0.0, 0.0, bias, converged, std::move(levels)};
+            double sampling_variance = 0.0;
+            for (const auto& level : result.levels) {
+                result.price += level.mean;
+                if (level.paths > 0) sampling_variance += level.variance / static_cast<double>(level.paths);
+            }
+            result.error_estimate = std::sqrt(sampling_variance);
+            return result;
+        }
+
+        // Running sums of every payoff of a portfolio over one batch, one column per statistic.
+        struct PortfolioAccumulator {
+            std::vector<double> sum;
+            std::vector<double> sum_sq;
+            size_t count = 0;
+
+            void merge(const PortfolioAccumulator& other) {
+                if (sum.empty()) {
+                    sum.assign(other.sum.size(), 0.0);
+                    sum_sq.assign(other.sum.size(), 0.0);
+                }
+                for (size_t i = 0; i < other.sum.size(); ++i) {
+                    sum[i] += other.sum[i];
+                    sum_sq[i] += other.sum_sq[i];
+                }
+                count += other.count;
+            }
+        };
+
+        /**
+         * Simulates each path once, as pathDependentEngine does, and evaluates every payoff of
+         * every book on it. Path values of payoff i accumulate in column i.
+         */
+        template<typename... Books>
+        static PortfolioResult portfolioEngine(double S0, const Parameters& r, const Parameters& sigma, const TimeGrid& grid,
+                                               size_t paths, const MonteCarloSettings& settings, const Books&... books) {
+            const size_t steps = grid.size();
+            const DriftDiffusionTable table(grid, r, sigma);
+            const BrownianBridge bridge(grid.times());
+            const size_t n_payoffs = (detail::bookPayOffs(books).size() + ... + 0);
+
+            PortfolioAccumulator total = runBatches<PortfolioAccumulator>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, PortfolioAccumulator& acc) {
+                PathNormals normals(settings, steps, first_path, rng, &bridge);
+                std::tuple<detail::BookEvaluator<typename decltype(detail::bookPayOffs(books))::value_type>...> evaluators(
+                    detail::bookPayOffs(books)...);
+
+                const double* drift = table.drift().data();
+                const double* diff = table.diffusion().data();
+                const std::span<const double> times = grid.times();
+                // Normals are drawn as priceEuropean (blocks of paths) or pricePathDependent (one path) does.
+                const size_t fill_paths = (steps == 1) ? kNormalBlock : 1;
+                std::vector<double> z(fill_paths * steps), path(steps), path_anti(settings.antithetic ? steps : 0);
+                std::vector<double> values(n_payoffs), values_anti(settings.antithetic ? n_payoffs : 0);
+                acc.sum.assign(n_payoffs, 0.0);
+                acc.sum_sq.assign(n_payoffs, 0.0);
+
+                auto evaluateAll = [&](const std::vector<double>& p, double* out) {
+                    std::apply([&](auto&... eval) {
+                        size_t offset = 0;
+                        ((eval.evaluate(S0, times, table.diffusion(), p, out + offset), offset += eval.size()), ...);
+                    }, evaluators);
+                };
+
+                for (size_t i = 0; i < n; ++i) {
+                    const size_t slot = i % fill_paths;
+                    if (slot == 0) normals.fill(std::span<double>(z.data(), std::min(fill_paths, n - i) * steps));
+                    const double* zi = z.data() + slot * steps;
+
+                    double current_S = S0;
+                    double current_S_anti = S0;
+                    for (size_t j = 0; j < steps; ++j) {
+                        current_S *= std::exp(drift[j] + diff[j] * zi[j]);
+                        path[j] = current_S;
+                        if (settings.antithetic) {
+                            current_S_anti *= std::exp(drift[j] - diff[j] * zi[j]);
+                            path_anti[j] = current_S_anti;
+                        }
+                    }
+
+                    evaluateAll(path, values.data());
+                    if (settings.antithetic) {
+                        evaluateAll(path_anti, values_anti.data());
+                        for (size_t k = 0; k < n_payoffs; ++k) values[k] = 0.5 * (values[k] + values_anti[k]);
+                    }
+                    for (size_t k = 0; k < n_payoffs; ++k) {
+                        acc.sum[k] += values[k];
+                        acc.sum_sq[k] += values[k] * values[k];
+                    }
+                }
+                acc.count += n;
+            });
+
+            PortfolioResult result;
+            result.paths = paths;
+            result.price.resize(n_payoffs);
+            result.error_estimate.resize(n_payoffs);
+            for (size_t k = 0; k < n_payoffs && total.count > 0; ++k) {
+                const PathAccumulator column{total.sum[k], total.sum_sq[k], total.count};
+                const SimResult sim = column.result(table.discountFactor());
+                result.price[k] = sim.price;
+                result.error_estimate[k] = sim.std_err;
+            }
+            return result;
+        }
+
     public:
         // Templated European Pricer (With Gatherer Concept)
+        // The gatherer receives the likelihood-ratio weighted values when `sampling` shifts the draws.
         template<typename PayoffType, StatisticsGatherer GathererType>
         static void priceEuropean(double S0, const Parameters& r, const Parameters& sigma, double T, 
-                                  size_t paths, const PayoffType& payoff, GathererType& gatherer) {
-            runSimulation(S0, r, sigma, T, paths, payoff, gatherer);
+                                  size_t paths, const PayoffType& payoff, GathererType& gatherer,
+                                  const ImportanceSampling& sampling = {}) {
+            runSimulation(S0, r, sigma, T, paths, payoff, gatherer, nullptr, 1000, RunControl{}, sampling);
         }
 
         // Templated European Pricer (Async) - References the gatherer
         // User (Caller) is responsible for ensuring 'gatherer' exists for the duration of the future.
+        // Runs priceEuropean(gatherer) as one task on ThreadPool::global().
         template<typename PayoffType, StatisticsGatherer GathererType>
         static std::future<void> priceEuropeanAsync(
             double S0, const Parameters& r, const Parameters& sigma, double T, 
@@ -160,89 +2130,260 @@ namespace GreekCore {
             // Capture gatherer by reference. 
             // Note: We capture S0, r, sigma... by value to ensure they exist.
             // But gatherer is passed by reference to let the caller own it.
-            return std::async(std::launch::async, [S0, r, sigma, T, paths, payoff, &gatherer]() {
+            return ThreadPool::global().submit([S0, r, sigma, T, paths, payoff, &gatherer]() {
                 runSimulation(S0, r, sigma, T, paths, payoff, gatherer);
             });
         }
 
+        // Templated European Pricer (Async, cancellable): as above, but checks `stop` and `deadline`
+        // every kNormalBlock paths. On either, the run ends early and the result (price and error
+        // from the gatherer, paths simulated, stop reason) describes the paths gathered so far.
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static std::future<MonteCarloRunResult> priceEuropeanAsync(
+            double S0, const Parameters& r, const Parameters& sigma, double T,
+            size_t paths, const PayoffType& payoff, GathererType& gatherer, std::stop_token stop,
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max())
+        {
+            return ThreadPool::global().submit([S0, r, sigma, T, paths, payoff, &gatherer, control = RunControl{std::move(stop), deadline}]() {
+                return completeRun(runSimulation(S0, r, sigma, T, paths, payoff, gatherer, nullptr, 1000, control), gatherer);
+            });
+        }
+
+        // Templated European Pricer (Async, split): every batch of settings.paths_per_batch paths is
+        // a separate task on `pool`, so idle workers pick up (steal) the batches of a large job.
+        // The gatherer receives the discounted path values of priceEuropean(settings) in path order,
+        // from one task at a time, and the future is ready once all of them are gathered.
+        // settings.threads is not used: the pool size bounds the parallelism.
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static std::future<MonteCarloRunResult> priceEuropeanAsync(
+            double S0, const Parameters& r, const Parameters& sigma, double T,
+            size_t paths, const PayoffType& payoff, GathererType& gatherer,
+            const MonteCarloSettings& settings, ThreadPool& pool = ThreadPool::global())
+        {
+            return asyncEngine(S0, r, sigma, T, paths, payoff, gatherer, settings, pool, RunControl{});
+        }
+
+        // Split asynchronous pricer that stops at batch boundaries once `stop` is requested or
+        // `deadline` passes; the result then covers the first result.paths paths of the full run.
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static std::future<MonteCarloRunResult> priceEuropeanAsync(
+            double S0, const Parameters& r, const Parameters& sigma, double T,
+            size_t paths, const PayoffType& payoff, GathererType& gatherer,
+            const MonteCarloSettings& settings, std::stop_token stop,
+            std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max(),
+            ThreadPool& pool = ThreadPool::global())
+        {
+            return asyncEngine(S0, r, sigma, T, paths, payoff, gatherer, settings, pool, RunControl{std::move(stop), deadline});
+        }
+
         // Templated European Pricer (Convenience with Greeks)
+        // Paths are distributed over settings.threads workers; see MonteCarloSettings.
         template<typename PayoffType>
         static MonteCarloResult priceEuropean(double S0, const Parameters& r, const Parameters& sigma, double T, 
-                                            size_t paths, const PayoffType& payoff) {
-            
-            auto engine_logic = [&](double S_loc, const Parameters& r_loc, const Parameters& sigma_loc, double T_loc) -> SimResult {
-                StatisticsMean localGatherer;
-                runSimulation(S_loc, r_loc, sigma_loc, T_loc, paths, payoff, localGatherer);
-                
-                auto results = localGatherer.getResultsSoFar();
-                return {results[0][0], results[0][1]};
-            };
+                                            size_t paths, const PayoffType& payoff,
+                                            const MonteCarloSettings& settings = {}) {
+            return europeanEngine(S0, r, sigma, T, paths, payoff, NoControl{}, settings);
+        }
+
+        // Adaptive European Pricer: simulates until the standard error reaches tolerance.tolerance,
+        // tolerance.max_paths paths are used or tolerance.deadline passes, checking after every
+        // round of settings.threads batches. The gatherer receives every discounted path value and
+        // is read through takeSnapshot(): a SnapshotGatherer, or getResultsSoFar()[0] = [mean, standard error].
+        // Up to the gatherer's summation, the price is that of priceEuropean() with result.paths paths.
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static MonteCarloToleranceResult priceToTolerance(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                          const PayoffType& payoff, GathererType& gatherer,
+                                                          const ToleranceSettings& tolerance,
+                                                          const MonteCarloSettings& settings = {}) {
+            return toleranceEngine(S0, r, sigma, T, payoff, gatherer, tolerance, settings);
+        }
+
+        // Adaptive European Pricer gathering mean and standard error with StatisticsMean.
+        template<typename PayoffType>
+        static MonteCarloToleranceResult priceToTolerance(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                          const PayoffType& payoff, const ToleranceSettings& tolerance,
+                                                          const MonteCarloSettings& settings = {}) {
+            StatisticsMean gatherer;
+            return toleranceEngine(S0, r, sigma, T, payoff, gatherer, tolerance, settings);
+        }
 
-            return calculateWithGreeks(S0, r, sigma, T, engine_logic);
+        // Templated European Pricer with a control variate (evaluated on the same terminal spot)
+        template<typename PayoffType, typename ControlPayOffType>
+        static MonteCarloResult priceEuropean(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                            size_t paths, const PayoffType& payoff,
+                                            const ControlVariate<ControlPayOffType>& control,
+                                            const MonteCarloSettings& settings = {}) {
+            return europeanEngine(S0, r, sigma, T, paths, payoff, control, settings);
         }
 
         // Templated Path Dependent Pricer
+        // Paths are distributed over settings.threads workers; see MonteCarloSettings.
+        // The payoff is either a PayOff on std::vector<double> (the full path) or a StreamingPayOff.
         template<typename PayoffType>
         static MonteCarloResult pricePathDependent(double S0, const Parameters& r, const Parameters& sigma, double T, 
                                             size_t paths, size_t steps,
-                                            const PayoffType& payoff) {
-            
-            auto engine_logic = [&](double S_loc, const Parameters& r_loc, const Parameters& sigma_loc, double T_loc) -> SimResult {
-                double dt = T_loc / steps;
-                
-                // Precompute step parameters (approximation: assume constant over step)
-                // Ideally we would integrate r and sigma over [t, t+dt] for each step
-                double df = std::exp(-r_loc.integral(0.0, T_loc));
-                
-                Xoshiro256 local_rng(42); 
-
-                double sum = 0.0;
-                double sum_sq = 0.0;
-                
-                std::vector<double> path(steps);
-
-                for (size_t i = 0; i < paths; ++i) {
-                    double current_S = S_loc;
-                    double current_time = 0.0;
-
-                    for(size_t j=0; j<steps; ++j) {
-                        double next_time = current_time + dt;
-                        
-                        // Exact integration for this step
-                        double r_step = r_loc.integral(current_time, next_time);
-                        double vol_sq_step = sigma_loc.integralSquare(current_time, next_time);
-                        
-                        double drift = r_step - 0.5 * vol_sq_step;
-                        double diff = std::sqrt(vol_sq_step);
-
-                        double u1 = Xoshiro256::to_double(local_rng());
-                        if (u1 < 1e-9) u1 = 1e-9;
-                        double u2 = Xoshiro256::to_double(local_rng());
-                        
-                        double R = std::sqrt(-2.0 * std::log(u1));
-                        double theta_bm = 2.0 * std::numbers::pi * u2;
-                        double z = R * std::cos(theta_bm);
-
-                        current_S *= std::exp(drift + diff * z);
-                        path[j] = current_S;
-                        
-                        current_time = next_time;
-                    }
-                    
-                    double val = payoff(path);
-                    sum += val;
-                    sum_sq += val * val;
-                }
-                
-                double mean = (paths > 0) ? (sum / paths) : 0.0;
-                double variance = (paths > 1) ? ((sum_sq - paths * mean * mean) / (paths - 1)) : 0.0;
-                if (variance < 0) variance = 0.0;
-                double std_err = std::sqrt(variance) / std::sqrt(paths);
+                                            const PayoffType& payoff,
+                                            const MonteCarloSettings& settings = {}) {
+            return pathDependentEngine(S0, r, sigma, TimeGrid(T, steps), paths, payoff, NoControl{}, settings);
+        }
 
-                return {mean * df, std_err * df};
-            };
+        // Templated Path Dependent Pricer on an arbitrary grid (e.g. fixing dates); the path passed
+        // to the payoff holds the spot at each grid time and the maturity is grid.maturity().
+        template<typename PayoffType>
+        static MonteCarloResult pricePathDependent(double S0, const Parameters& r, const Parameters& sigma,
+                                            const TimeGrid& grid, size_t paths,
+                                            const PayoffType& payoff,
+                                            const MonteCarloSettings& settings = {}) {
+            return pathDependentEngine(S0, r, sigma, grid, paths, payoff, NoControl{}, settings);
+        }
+
+        // Portfolio Pricer: prices many payoffs on the same underlying from one set of paths.
+        // Each book is a payoff or a contiguous range (e.g. std::vector) of payoffs of one type;
+        // books may mix terminal payoffs (on the spot at maturity), PayOffs on the path and
+        // StreamingPayOffs. Each path is simulated once on `grid` and every payoff is evaluated on
+        // it; each price equals pricePathDependent(grid, settings) for that payoff alone (or
+        // priceEuropean(settings) for a terminal payoff on a one-step grid).
+        template<typename... Books>
+        static PortfolioResult pricePortfolio(double S0, const Parameters& r, const Parameters& sigma,
+                                              const TimeGrid& grid, size_t paths,
+                                              const MonteCarloSettings& settings, const Books&... books) {
+            return portfolioEngine(S0, r, sigma, grid, paths, settings, books...);
+        }
+
+        // Portfolio Pricer for payoffs on the spot at maturity T (e.g. an option chain).
+        template<typename... Books>
+        static PortfolioResult pricePortfolio(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                              size_t paths, const MonteCarloSettings& settings, const Books&... books) {
+            return portfolioEngine(S0, r, sigma, TimeGrid(T, 1), paths, settings, books...);
+        }
+
+        // Heston Pricer: QE simulation of the Heston model (see HestonQEScheme) on `grid`, with
+        // settings.max_time_step controlling the discretization. The payoff is a terminal PayOff,
+        // a PayOff on the path (spots at the grid times) or a StreamingPayOff. Batches, streams
+        // and threads follow MonteCarloSettings; Brownian bridge construction is not used.
+        template<typename PayoffType>
+        static MonteCarloRunResult priceHeston(double S0, const Parameters& r, const HestonParameters& heston,
+                                               const TimeGrid& grid, size_t paths, const PayoffType& payoff,
+                                               const MonteCarloSettings& settings = {}) {
+            const HestonQEScheme scheme(heston, r, grid, settings.max_time_step);
+            PathAccumulator total = runBatches<PathAccumulator>(paths, settings, [&](size_t first_path, size_t n, Xoshiro256& rng, PathAccumulator& acc) {
+                hestonBatch(S0, scheme, grid, payoff, settings, first_path, n, rng, [&acc](double value) { acc.add(value); });
+            });
+            const SimResult sim = total.result(1.0);
+            return {sim.price, sim.std_err, paths, StopReason::MaxPaths};
+        }
+
+        // Heston Pricer for a payoff on the spot at maturity T.
+        template<typename PayoffType>
+        static MonteCarloRunResult priceHeston(double S0, const Parameters& r, const HestonParameters& heston, double T,
+                                               size_t paths, const PayoffType& payoff,
+                                               const MonteCarloSettings& settings = {}) {
+            return priceHeston(S0, r, heston, TimeGrid(T, 1), paths, payoff, settings);
+        }
+
+        // Heston Pricer feeding every discounted path value to a gatherer, in path order (the same
+        // paths as priceHeston(settings)). Rounds of settings.threads batches are simulated and
+        // then gathered, so memory stays bounded by one round.
+        template<typename PayoffType, StatisticsGatherer GathererType>
+        static void priceHeston(double S0, const Parameters& r, const HestonParameters& heston,
+                                const TimeGrid& grid, size_t paths, const PayoffType& payoff,
+                                GathererType& gatherer, const MonteCarloSettings& settings = {}) {
+            const HestonQEScheme scheme(heston, r, grid, settings.max_time_step);
+            const size_t round_paths = resolveThreads(settings.threads) * std::max<size_t>(settings.paths_per_batch, 1);
+            const size_t round_batches = resolveThreads(settings.threads);
+            for (size_t done = 0, next_batch = 0; done < paths; done += round_paths, next_batch += round_batches) {
+                PathValues round = runBatches<PathValues>(std::min(round_paths, paths - done), settings, [&](size_t first_path, size_t n, Xoshiro256& rng, PathValues& acc) {
+                    acc.values.reserve(n);
+                    hestonBatch(S0, scheme, grid, payoff, settings, first_path, n, rng, [&acc](double value) { acc.values.push_back(value); });
+                }, next_batch);
+                for (double value : round.values) gatherer.dumpOneResult(value);
+            }
+        }
+
+        // Multi-asset Pricer: correlated Black-Scholes assets (one volatility term structure each,
+        // correlation through its Cholesky factor) simulated on `grid`. The payoff takes the
+        // terminal spots (std::span<const double>, e.g. PayOffBasket, PayOffSpread, PayOffRainbow)
+        // or a MultiAssetPath of the spots at every grid time. Paths draw assets x steps normals;
+        // batches, streams and threads follow MonteCarloSettings.
+        template<typename PayoffType>
+        static MonteCarloRunResult priceMultiAsset(const MultiAssetMarket& market, const TimeGrid& grid, size_t paths,
+                                                   const PayoffType& payoff, const MonteCarloSettings& settings = {}) {
+            return multiAssetEngine(market, grid, paths, payoff, settings);
+        }
+
+        // Multi-asset Pricer for a payoff on the terminal spots at maturity T (one step).
+        template<typename PayoffType>
+        static MonteCarloRunResult priceMultiAsset(const MultiAssetMarket& market, double T, size_t paths,
+                                                   const PayoffType& payoff, const MonteCarloSettings& settings = {}) {
+            return multiAssetEngine(market, TimeGrid(T, 1), paths, payoff, settings);
+        }
+
+        // Bermudan Pricer (Longstaff-Schwartz): the payoff (on the spot, e.g. PayOffVanilla) may
+        // be exercised at every date of `exercise_dates`, the last one being the maturity. A
+        // regression pass fits the exercise rule, an independent pricing pass of `paths` paths
+        // prices it; see EarlyExerciseSettings for the regression basis and memory budget.
+        // settings.antithetic only applies to the pricing pass.
+        template<typename PayoffType>
+        static MonteCarloRunResult priceBermudan(double S0, const Parameters& r, const Parameters& sigma,
+                                                 const TimeGrid& exercise_dates, size_t paths, const PayoffType& payoff,
+                                                 const EarlyExerciseSettings& lsm = {}, const MonteCarloSettings& settings = {}) {
+            return earlyExerciseEngine(S0, r, sigma, exercise_dates, paths, payoff, lsm, settings);
+        }
+
+        // American Pricer: Bermudan approximation with `exercise_steps` equally spaced exercise
+        // dates up to T (exercise at time 0 is not included).
+        template<typename PayoffType>
+        static MonteCarloRunResult priceAmerican(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                 size_t exercise_steps, size_t paths, const PayoffType& payoff,
+                                                 const EarlyExerciseSettings& lsm = {}, const MonteCarloSettings& settings = {}) {
+            return earlyExerciseEngine(S0, r, sigma, TimeGrid(T, exercise_steps), paths, payoff, lsm, settings);
+        }
+
+        // Multilevel Pricer: Giles' multilevel estimator of a path-dependent payoff (vector, streaming
+        // or terminal, as in pricePathDependent) monitored on the finest level's grid, simulated to
+        // a root mean square error of mlmc.target_rmse. Coarse and fine paths of a level share their
+        // Brownian increments. The corrections of each level are gathered in a GathererType
+        // (default StatisticsWelford); the result reports every level's paths, mean, variance and
+        // cost. settings.antithetic pairs the corrections; QuasiRandom error estimates are conservative.
+        template<typename PayoffType, MergeableGatherer GathererType = StatisticsWelford>
+        static MultilevelResult priceMultilevel(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                const PayoffType& payoff, const MultilevelSettings& mlmc = {},
+                                                const MonteCarloSettings& settings = {}) {
+            return multilevelEngine<PayoffType, GathererType>(S0, r, sigma, T, payoff, mlmc, settings);
+        }
+
+        // Templated Path Dependent Pricer with a control variate (evaluated on the same path),
+        // e.g. an arithmetic PayOffAsian with makeGeometricAsianControl().
+        template<typename PayoffType, typename ControlPayOffType>
+        static MonteCarloResult pricePathDependent(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                            size_t paths, size_t steps,
+                                            const PayoffType& payoff,
+                                            const ControlVariate<ControlPayOffType>& control,
+                                            const MonteCarloSettings& settings = {}) {
+            return pathDependentEngine(S0, r, sigma, TimeGrid(T, steps), paths, payoff, control, settings);
+        }
+
+        // European Pricer with adjoint (AAD) sensitivities to S0 and every node of r and sigma.
+        // The payoff must also be callable on a Number (see PayOff and AAD.h). For the same settings
+        // the price is identical to priceEuropean().
+        template<typename PayoffType>
+        static MonteCarloAADResult priceEuropeanAAD(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                    size_t paths, const PayoffType& payoff,
+                                                    const MonteCarloSettings& settings = {}) {
+            return aadEngine(S0, r, sigma, TimeGrid(T, 1), paths, settings, [&](const std::vector<Number>& path) {
+                return Number(payoff(path.back()));
+            });
+        }
 
-            return calculateWithGreeks(S0, r, sigma, T, engine_logic);
+        // Path Dependent Pricer with adjoint (AAD) sensitivities to S0 and every node of r and sigma.
+        // The payoff must also be callable on a std::vector<Number>.
+        template<typename PayoffType>
+        static MonteCarloAADResult pricePathDependentAAD(double S0, const Parameters& r, const Parameters& sigma, double T,
+                                                         size_t paths, size_t steps, const PayoffType& payoff,
+                                                         const MonteCarloSettings& settings = {}) {
+            return aadEngine(S0, r, sigma, TimeGrid(T, steps), paths, settings, [&](const std::vector<Number>& path) {
+                return Number(payoff(path));
+            });
         }
     };
 }
@@ -0,0 +1,97 @@
+#ifndef GREEKCORE_MULTIASSETPAYOFF_H
+#define GREEKCORE_MULTIASSETPAYOFF_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "GreekCore/Pricing/PayOff.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief Simulated path of several assets, step-major: the spot of asset a at grid time
+     * $t_j$ is spot(j, a). Passed to path payoffs by priceMultiAsset().
+     */
+    class MultiAssetPath {
+    public:
+        MultiAssetPath(std::span<const double> spots, size_t assets) : m_spots(spots), m_assets(assets) {}
+
+        size_t assets() const { return m_assets; }
+        size_t steps() const { return m_spots.size() / m_assets; }
+        double spot(size_t j, size_t a) const { return m_spots[j * m_assets + a]; }
+
+        /// Spots of every asset at grid time t_j.
+        std::span<const double> at(size_t j) const { return m_spots.subspan(j * m_assets, m_assets); }
+        std::span<const double> terminal() const { return at(steps() - 1); }
+
+    private:
+        std::span<const double> m_spots;
+        size_t m_assets;
+    };
+
+    /**
+     * @brief Multi-asset payoff on the terminal spots (one per asset).
+     */
+    template<typename P>
+    concept MultiAssetPayOff = requires(const P& payoff, std::span<const double> spots) {
+        { payoff(spots) } -> std::convertible_to<double>;
+    };
+
+    /**
+     * @brief Multi-asset payoff on the whole path (see MultiAssetPath).
+     */
+    template<typename P>
+    concept MultiAssetPathPayOff = requires(const P& payoff, const MultiAssetPath& path) {
+        { payoff(path) } -> std::convertible_to<double>;
+    };
+
+    /**
+     * @brief Basket option: $\max(\pm(\sum_i w_i S_i(T) - K), 0)$.
+     */
+    class PayOffBasket {
+    public:
+        PayOffBasket(OptionType type, std::vector<double> weights, double strike)
+            : m_type(type), m_weights(std::move(weights)), m_strike(strike) {}
+        [[nodiscard]] double operator()(std::span<const double> spots) const;
+    private:
+        OptionType m_type;
+        std::vector<double> m_weights;
+        double m_strike;
+    };
+
+    /**
+     * @brief Spread option on the first two assets: $\max(\pm(S_1(T) - S_2(T) - K), 0)$
+     * (K = 0: Margrabe's exchange option).
+     */
+    class PayOffSpread {
+    public:
+        PayOffSpread(OptionType type, double strike) : m_type(type), m_strike(strike) {}
+        [[nodiscard]] double operator()(std::span<const double> spots) const;
+    private:
+        OptionType m_type;
+        double m_strike;
+    };
+
+    enum class RainbowType {
+        BestOf, ///< On the best performer, $\max_i S_i(T) / S_i(0)$.
+        WorstOf ///< On the worst performer, $\min_i S_i(T) / S_i(0)$.
+    };
+
+    /**
+     * @brief Rainbow option on the best or worst performance: $\max(\pm(R - K), 0)$ where
+     * R is the best or worst of $S_i(T) / S_i(0)$ and K is a strike in performance terms (e.g. 1.0).
+     */
+    class PayOffRainbow {
+    public:
+        PayOffRainbow(RainbowType rainbow, OptionType type, std::vector<double> initial_spots, double strike)
+            : m_rainbow(rainbow), m_type(type), m_initial(std::move(initial_spots)), m_strike(strike) {}
+        [[nodiscard]] double operator()(std::span<const double> spots) const;
+    private:
+        RainbowType m_rainbow;
+        OptionType m_type;
+        std::vector<double> m_initial;
+        double m_strike;
+    };
+
+}
+#endif // GREEKCORE_MULTIASSETPAYOFF_H
@@ -4,6 +4,7 @@
 #include <memory>
 #include <vector>
 #include <cmath>
+#include <span>
 
 namespace GreekCore {
 
@@ -19,6 +20,20 @@ namespace GreekCore {
         virtual std::unique_ptr<ParametersInner> clone() const = 0;
         virtual double integral(double time1, double time2) const = 0;
         virtual double integralSquare(double time1, double time2) const = 0;
+
+        /**
+         * @brief Number of nodes (the values the parameter is built from), for sensitivities.
+         * Implementations that do not expose their nodes report none.
+         */
+        virtual size_t nodeCount() const { return 0; }
+        virtual double node(size_t /*index*/) const { return 0.0; }
+
+        /**
+         * @brief Derivatives of integral() / integralSquare() with respect to each node.
+         * @param gradient Span of size nodeCount(), overwritten.
+         */
+        virtual void integralGradient(double /*time1*/, double /*time2*/, std::span<double> /*gradient*/) const {}
+        virtual void integralSquareGradient(double /*time1*/, double /*time2*/, std::span<double> /*gradient*/) const {}
     };
 
     /**
@@ -34,6 +49,39 @@ namespace GreekCore {
         std::unique_ptr<ParametersInner> clone() const override;
         double integral(double time1, double time2) const override;
         double integralSquare(double time1, double time2) const override;
+
+        size_t nodeCount() const override { return 1; }
+        double node(size_t) const override { return m_constant; }
+        void integralGradient(double time1, double time2, std::span<double> gradient) const override;
+        void integralSquareGradient(double time1, double time2, std::span<double> gradient) const override;
+    };
+
+    /**
+     * @brief Piecewise constant parameter (e.g. a term structure of volatility).
+     *
+     * Takes `values[i]` on $(t_{i-1}, t_i]$ with $t_{-1} = 0$ and `times` increasing; the last
+     * value is extended beyond `times.back()`. Each value is a node.
+     */
+    class ParametersPiecewiseConstant : public ParametersInner {
+        std::vector<double> m_times;
+        std::vector<double> m_values;
+    public:
+        /**
+         * @throws std::invalid_argument If the sizes differ, are zero, or times are not increasing.
+         */
+        ParametersPiecewiseConstant(std::vector<double> times, std::vector<double> values);
+        std::unique_ptr<ParametersInner> clone() const override;
+        double integral(double time1, double time2) const override;
+        double integralSquare(double time1, double time2) const override;
+
+        size_t nodeCount() const override { return m_values.size(); }
+        double node(size_t index) const override { return m_values[index]; }
+        void integralGradient(double time1, double time2, std::span<double> gradient) const override;
+        void integralSquareGradient(double time1, double time2, std::span<double> gradient) const override;
+
+    private:
+        // Length of the overlap of [time1, time2] with each piece, written to `overlap`.
+        void overlaps(double time1, double time2, std::span<double> overlap) const;
     };
 
     /**
@@ -72,6 +120,12 @@ namespace GreekCore {
         double integralSquare(double time1, double time2) const;
         double mean(double time1, double time2) const;
         double rootMeanSquare(double time1, double time2) const;
+
+        // Node sensitivities (see ParametersInner)
+        size_t nodeCount() const;
+        double node(size_t index) const;
+        void integralGradient(double time1, double time2, std::span<double> gradient) const;
+        void integralSquareGradient(double time1, double time2, std::span<double> gradient) const;
     };
 
 }
@@ -5,11 +5,43 @@
 #include <cmath>
 #include <vector>
 #include <numeric>
+#include <concepts>
+#include <limits>
+#include <utility>
 
 namespace GreekCore {
 
+    class Number; // AAD.h
+
     enum class OptionType { Call, Put };
 
+    /**
+     * @brief Monte Carlo estimator a payoff supports for its Greeks.
+     */
+    enum class GreekEstimator {
+        FiniteDifference, ///< Bump and reprice only.
+        Pathwise,         ///< Differentiates the payoff along the path; requires derivative() (Lipschitz payoffs).
+        LikelihoodRatio   ///< Differentiates the density of S_T; suited to discontinuous payoffs.
+    };
+
+    /**
+     * @brief Market data type of a payoff when evaluated on AAD Numbers (no `type` for market
+     * data the AAD engines do not support).
+     */
+    template<typename MarketParameters> struct ActiveMarket {};
+    template<> struct ActiveMarket<double> { using type = Number; };
+    template<> struct ActiveMarket<std::vector<double>> { using type = std::vector<Number>; };
+
+    /**
+     * @brief Terminal payoffs that vanish outside an interval of spots, reported as
+     * `payoffRegion() = {lower, upper}` (0 / infinity when unbounded). Used to choose the
+     * automatic importance-sampling shift (see ImportanceSampling in MonteCarlo.h).
+     */
+    template<typename T>
+    concept RegionPayOff = requires(const T payoff) {
+        { payoff.payoffRegion() } -> std::convertible_to<std::pair<double, double>>;
+    };
+
     /**
      * @brief CRTP Base Class for Payoff definitions.
      *      * 
@@ -19,6 +51,12 @@ namespace GreekCore {
     template<typename Derived, typename MarketParameters>
     class PayOff {
     public:
+        /**
+         * @brief Greek estimator supported by the payoff. Derived classes redeclare it to opt in;
+         * Pathwise payoffs must also provide `derivativeImplementation()`.
+         */
+        static constexpr GreekEstimator greek_estimator = GreekEstimator::FiniteDifference;
+
         /**
          * @brief Evaluates the payoff for a given market scenario.
          * Delegates to the derived class's implementation.
@@ -26,9 +64,37 @@ namespace GreekCore {
         [[nodiscard]] double operator()(const MarketParameters& market_data) const {
             return static_cast<const Derived*>(this)->implementation(market_data);
         }
+
+        /**
+         * @brief Evaluates the payoff on AAD Numbers (for adjoint Greeks, see AAD.h).
+         * The derived class provides an `implementation()` overload taking the active market type.
+         */
+        template<typename Market = MarketParameters>
+            requires requires { typename ActiveMarket<Market>::type; }
+        [[nodiscard]] auto operator()(const typename ActiveMarket<Market>::type& market_data) const {
+            return static_cast<const Derived*>(this)->implementation(market_data);
+        }
+
+        /**
+         * @brief Derivative of the payoff with respect to the market data (Pathwise payoffs only).
+         */
+        [[nodiscard]] double derivative(const MarketParameters& market_data) const {
+            return static_cast<const Derived*>(this)->derivativeImplementation(market_data);
+        }
         PayOff() = default;
     };
 
+    /**
+     * @brief Greek estimator of any payoff type: its `greek_estimator`, or FiniteDifference for
+     * types that do not declare one (e.g. lambdas).
+     */
+    template<typename PayoffType>
+    inline constexpr GreekEstimator greekEstimatorOf = GreekEstimator::FiniteDifference;
+
+    template<typename PayoffType>
+        requires requires { { PayoffType::greek_estimator } -> std::convertible_to<GreekEstimator>; }
+    inline constexpr GreekEstimator greekEstimatorOf<PayoffType> = PayoffType::greek_estimator;
+
     /**
      * @brief A standard European option payoff (Call/Put).
      * 
@@ -52,6 +118,21 @@ namespace GreekCore {
          * @return The intrinsic value of the option.
          */
         [[nodiscard]] double implementation(double spot) const;
+        [[nodiscard]] Number implementation(const Number& spot) const;
+
+        static constexpr GreekEstimator greek_estimator = GreekEstimator::Pathwise;
+
+        /**
+         * @brief Derivative of the payoff with respect to $S_T$ (0 or ±1; the kink has measure zero).
+         */
+        [[nodiscard]] double derivativeImplementation(double spot) const;
+
+        /**
+         * @brief Spots where the payoff is non-zero (see RegionPayOff).
+         */
+        [[nodiscard]] std::pair<double, double> payoffRegion() const {
+            return m_type == OptionType::Call ? std::pair{m_strike, std::numeric_limits<double>::infinity()} : std::pair{0.0, m_strike};
+        }
     };
 
     // Digital Option
@@ -61,6 +142,12 @@ namespace GreekCore {
     public:
         PayOffDigital(OptionType type, double strike) : m_type(type), m_strike(strike) {}
         [[nodiscard]] double implementation(double spot) const;
+        [[nodiscard]] Number implementation(const Number& spot) const; // zero pathwise derivative
+        static constexpr GreekEstimator greek_estimator = GreekEstimator::LikelihoodRatio;
+
+        [[nodiscard]] std::pair<double, double> payoffRegion() const {
+            return m_type == OptionType::Call ? std::pair{m_strike, std::numeric_limits<double>::infinity()} : std::pair{0.0, m_strike};
+        }
     };
 
     // Double Digital Option
@@ -70,6 +157,10 @@ namespace GreekCore {
     public:
         PayOffDoubleDigital(double lower, double upper) : m_lower(lower), m_upper(upper) {}
         [[nodiscard]] double implementation(double spot) const;
+        [[nodiscard]] Number implementation(const Number& spot) const; // zero pathwise derivative
+        static constexpr GreekEstimator greek_estimator = GreekEstimator::LikelihoodRatio;
+
+        [[nodiscard]] std::pair<double, double> payoffRegion() const { return {m_lower, m_upper}; }
     };
 
     // Path Dependent: Asian Arithmetic Mean Option
@@ -79,6 +170,17 @@ namespace GreekCore {
     public:
         PayOffAsian(OptionType type, double strike) : m_type(type), m_strike(strike) {}
         [[nodiscard]] double implementation(const std::vector<double>& spot_path) const;
+        [[nodiscard]] Number implementation(const std::vector<Number>& spot_path) const;
+    };
+
+    // Path Dependent: Asian Geometric Mean Option (closed form available, see ControlVariate.h)
+    class PayOffGeometricAsian : public PayOff<PayOffGeometricAsian, std::vector<double>> {
+        OptionType m_type;
+        double m_strike;
+    public:
+        PayOffGeometricAsian(OptionType type, double strike) : m_type(type), m_strike(strike) {}
+        [[nodiscard]] double implementation(const std::vector<double>& spot_path) const;
+        [[nodiscard]] Number implementation(const std::vector<Number>& spot_path) const;
     };
 
 }
@@ -0,0 +1,262 @@
+#ifndef GREEKCORE_STREAMINGPAYOFF_H
+#define GREEKCORE_STREAMINGPAYOFF_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Pricing/Barrier.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief Streaming payoffs observed as `observe(t, S, step_variance)`, with the variance
+     * $\int \sigma^2$ of the log spot since the previous observation. The lognormal engines
+     * take it from the DriftDiffusionTable of each market, so the vega scenarios bump it too.
+     */
+    template<typename T>
+    concept StepVarianceObserver = requires(T payoff, double t, double spot, double step_variance) {
+        payoff.observe(t, spot, step_variance);
+    };
+
+    /**
+     * @brief Path functional evaluated on the fly, without materializing the path.
+     *
+     * For each path the engine calls `reset(S0)`, then `observe(t, S)` (or, for a
+     * StepVarianceObserver, `observe(t, S, step_variance)`) at every grid time in increasing
+     * order, then `finish()` for the (undiscounted) payoff. The engine copies the payoff per
+     * worker, so the running state lives in the object and should be O(1).
+     * Payoffs that need the whole path keep using `PayOff<Derived, std::vector<double>>`.
+     */
+    template<typename T>
+    concept StreamingPayOff = std::copy_constructible<T>
+        && requires(T payoff, double spot) {
+            payoff.reset(spot);
+            { payoff.finish() } -> std::convertible_to<double>;
+        }
+        && (requires(T payoff, double t, double spot) { payoff.observe(t, spot); } || StepVarianceObserver<T>);
+
+    /**
+     * @brief Arithmetic average rate option over the observations (same as PayOffAsian).
+     */
+    class StreamingAsian {
+        OptionType m_type;
+        double m_strike;
+        double m_sum = 0.0;
+        size_t m_count = 0;
+    public:
+        StreamingAsian(OptionType type, double strike) : m_type(type), m_strike(strike) {}
+
+        void reset(double /*spot*/) {
+            m_sum = 0.0;
+            m_count = 0;
+        }
+
+        void observe(double /*t*/, double spot) {
+            m_sum += spot;
+            ++m_count;
+        }
+
+        [[nodiscard]] double finish() const {
+            if (m_count == 0) return 0.0;
+            double avg = m_sum / m_count;
+            return (m_type == OptionType::Call) ? std::max(avg - m_strike, 0.0) : std::max(m_strike - avg, 0.0);
+        }
+    };
+
+    /**
+     * @brief Lookback option on the running extremes (initial spot included).
+     *
+     * Floating strike: call $S_T - \min S$, put $\max S - S_T$.
+     * Fixed strike: call $\max(\max S - K, 0)$, put $\max(K - \min S, 0)$.
+     */
+    class StreamingLookback {
+        OptionType m_type;
+        double m_strike;
+        bool m_fixed_strike;
+        double m_min = 0.0;
+        double m_max = 0.0;
+        double m_last = 0.0;
+    public:
+        /// Floating strike lookback.
+        explicit StreamingLookback(OptionType type) : m_type(type), m_strike(0.0), m_fixed_strike(false) {}
+
+        /// Fixed strike lookback.
+        StreamingLookback(OptionType type, double strike) : m_type(type), m_strike(strike), m_fixed_strike(true) {}
+
+        void reset(double spot) {
+            m_min = m_max = m_last = spot;
+        }
+
+        void observe(double /*t*/, double spot) {
+            m_min = std::min(m_min, spot);
+            m_max = std::max(m_max, spot);
+            m_last = spot;
+        }
+
+        [[nodiscard]] double finish() const {
+            if (m_fixed_strike) {
+                return (m_type == OptionType::Call) ? std::max(m_max - m_strike, 0.0) : std::max(m_strike - m_min, 0.0);
+            }
+            return (m_type == OptionType::Call) ? m_last - m_min : m_max - m_last;
+        }
+    };
+
+    /**
+     * @brief Discretely monitored knock-in / knock-out vanilla option.
+     *
+     * The barrier is checked at the initial spot and at every observation; the vanilla payoff
+     * is paid on the last observation if the option is alive.
+     */
+    class StreamingBarrier {
+        BarrierType m_barrier_type;
+        double m_barrier;
+        PayOffVanilla m_vanilla;
+        bool m_hit = false;
+        double m_last = 0.0;
+
+        bool crosses(double spot) const {
+            bool up = (m_barrier_type == BarrierType::UpAndOut || m_barrier_type == BarrierType::UpAndIn);
+            return up ? spot >= m_barrier : spot <= m_barrier;
+        }
+    public:
+        StreamingBarrier(BarrierType barrier_type, double barrier, OptionType type, double strike)
+            : m_barrier_type(barrier_type), m_barrier(barrier), m_vanilla(type, strike) {}
+
+        void reset(double spot) {
+            m_hit = crosses(spot);
+            m_last = spot;
+        }
+
+        void observe(double /*t*/, double spot) {
+            m_hit = m_hit || crosses(spot);
+            m_last = spot;
+        }
+
+        [[nodiscard]] double finish() const {
+            bool knock_in = (m_barrier_type == BarrierType::UpAndIn || m_barrier_type == BarrierType::DownAndIn);
+            bool alive = knock_in ? m_hit : !m_hit;
+            return alive ? m_vanilla(m_last) : 0.0;
+        }
+    };
+
+    /**
+     * @brief Continuously monitored knock-in / knock-out vanilla option, simulated with the
+     * Brownian-bridge crossing correction.
+     *
+     * Between two observations the log spot is a Brownian bridge, so the probability that the
+     * barrier was not crossed in between is known (bridgeSurvivalProbability()). Instead of
+     * only checking the observed spots, each path is weighted by the product $P$ of these
+     * probabilities: knock-outs pay $V(S_T) P$, knock-ins $V(S_T)(1 - P)$. This removes the
+     * $O(\sqrt{\Delta t})$ bias of discrete monitoring, so coarse grids (e.g. weekly) price
+     * continuous barriers, and also lowers the variance.
+     *
+     * The probabilities use the step variance supplied by the engine (StepVarianceObserver).
+     */
+    class StreamingBridgeBarrier {
+        BarrierType m_barrier_type;
+        double m_barrier;
+        PayOffVanilla m_vanilla;
+        double m_survival = 1.0;
+        double m_log_distance = 0.0; // ln(H / S) of the last observation, > 0 on the alive side
+        double m_last = 0.0;
+
+        bool up() const { return m_barrier_type == BarrierType::UpAndOut || m_barrier_type == BarrierType::UpAndIn; }
+        double logDistance(double spot) const { return up() ? std::log(m_barrier / spot) : std::log(spot / m_barrier); }
+    public:
+        StreamingBridgeBarrier(BarrierType barrier_type, double barrier, OptionType type, double strike)
+            : m_barrier_type(barrier_type), m_barrier(barrier), m_vanilla(type, strike) {}
+
+        void reset(double spot) {
+            m_log_distance = logDistance(spot);
+            m_survival = m_log_distance > 0.0 ? 1.0 : 0.0;
+            m_last = spot;
+        }
+
+        void observe(double /*t*/, double spot, double step_variance) {
+            if (m_survival > 0.0) {
+                // bridgeSurvivalProbability() with the previous step's logarithm reused.
+                const double distance = logDistance(spot);
+                if (distance <= 0.0) m_survival = 0.0;
+                else if (step_variance > 0.0) m_survival *= -std::expm1(-2.0 * m_log_distance * distance / step_variance);
+                m_log_distance = distance;
+            }
+            m_last = spot;
+        }
+
+        [[nodiscard]] double finish() const {
+            bool knock_in = (m_barrier_type == BarrierType::UpAndIn || m_barrier_type == BarrierType::DownAndIn);
+            return (knock_in ? 1.0 - m_survival : m_survival) * m_vanilla(m_last);
+        }
+    };
+
+    enum class DoubleBarrierType { KnockOut, KnockIn };
+
+    /**
+     * @brief Continuously monitored double knock-out / knock-in vanilla option on the corridor
+     * (lower, upper), with the Brownian-bridge crossing correction of StreamingBridgeBarrier
+     * (probability of staying inside both barriers over each step).
+     */
+    class StreamingDoubleBarrier {
+        DoubleBarrierType m_barrier_type;
+        double m_lower;
+        double m_upper;
+        PayOffVanilla m_vanilla;
+        double m_survival = 1.0;
+        double m_last = 0.0;
+    public:
+        StreamingDoubleBarrier(DoubleBarrierType barrier_type, double lower, double upper, OptionType type, double strike)
+            : m_barrier_type(barrier_type), m_lower(lower), m_upper(upper), m_vanilla(type, strike) {}
+
+        void reset(double spot) {
+            m_survival = (spot > m_lower && spot < m_upper) ? 1.0 : 0.0;
+            m_last = spot;
+        }
+
+        void observe(double /*t*/, double spot, double step_variance) {
+            if (m_survival > 0.0) {
+                m_survival *= bridgeSurvivalProbability(m_lower, m_upper, m_last, spot, step_variance);
+            }
+            m_last = spot;
+        }
+
+        [[nodiscard]] double finish() const {
+            return (m_barrier_type == DoubleBarrierType::KnockIn ? 1.0 - m_survival : m_survival) * m_vanilla(m_last);
+        }
+    };
+
+    /**
+     * @brief Cliquet: sum of locally floored and capped period returns, globally floored.
+     *
+     * Each observation closes a period: $r_i = S(t_i) / S(t_{i-1}) - 1$ with $t_0$ the start.
+     * Pays $\max(F, \sum_i \min(c, \max(f, r_i)))$ per unit notional.
+     */
+    class StreamingCliquet {
+        double m_local_floor;
+        double m_local_cap;
+        double m_global_floor;
+        double m_sum = 0.0;
+        double m_last = 0.0;
+    public:
+        StreamingCliquet(double local_floor, double local_cap, double global_floor)
+            : m_local_floor(local_floor), m_local_cap(local_cap), m_global_floor(global_floor) {}
+
+        void reset(double spot) {
+            m_sum = 0.0;
+            m_last = spot;
+        }
+
+        void observe(double /*t*/, double spot) {
+            double ret = spot / m_last - 1.0;
+            m_sum += std::min(m_local_cap, std::max(m_local_floor, ret));
+            m_last = spot;
+        }
+
+        [[nodiscard]] double finish() const {
+            return std::max(m_global_floor, m_sum);
+        }
+    };
+
+}
+#endif // GREEKCORE_STREAMINGPAYOFF_H
@@ -0,0 +1,74 @@
+#ifndef GREEKCORE_TIMEGRID_H
+#define GREEKCORE_TIMEGRID_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "GreekCore/Pricing/Parameters.h"
+
+namespace GreekCore {
+
+    /**
+     * @brief Simulation dates $0 < t_1 < \dots < t_n$ of a path (e.g. the fixing dates of an Asian).
+     *
+     * The spot is observed at every grid time; the last time is the maturity.
+     */
+    class TimeGrid {
+    public:
+        /**
+         * @brief Uniform grid of `steps` steps over [0, maturity].
+         * @throws std::invalid_argument If steps is zero or maturity is not positive.
+         */
+        TimeGrid(double maturity, size_t steps);
+
+        /**
+         * @brief Arbitrary grid.
+         * @throws std::invalid_argument If the times are empty, not positive or not strictly increasing.
+         */
+        explicit TimeGrid(std::vector<double> times);
+
+        size_t size() const { return m_times.size(); }
+        double maturity() const { return m_maturity; }
+        double operator[](size_t j) const { return m_times[j]; }
+        std::span<const double> times() const { return m_times; }
+
+        /**
+         * @brief The same relative spacing over [0, maturity] (used by the theta bump).
+         */
+        TimeGrid rescaled(double maturity) const;
+
+    private:
+        std::vector<double> m_times;
+        double m_maturity;
+        bool m_uniform;
+    };
+
+    /**
+     * @brief Per-step coefficients of Black-Scholes dynamics on a TimeGrid.
+     *
+     * $\ln S(t_j) - \ln S(t_{j-1}) = drift_j + diffusion_j z_j$ with
+     * $drift_j = \int r - \frac{1}{2}\int \sigma^2$ and $diffusion_j = \sqrt{\int \sigma^2}$ over
+     * $[t_{j-1}, t_j]$. The Monte Carlo engines build one table per market (each Greeks scenario
+     * has its own) before the path loop, which then makes no call through the Parameters bridge.
+     */
+    class DriftDiffusionTable {
+    public:
+        DriftDiffusionTable(const TimeGrid& grid, const Parameters& r, const Parameters& sigma);
+
+        size_t size() const { return m_drift.size(); }
+        std::span<const double> drift() const { return m_drift; }
+        std::span<const double> diffusion() const { return m_diffusion; }
+
+        /**
+         * @return The discount factor to the grid maturity, $e^{-\int_0^T r}$.
+         */
+        double discountFactor() const { return m_discount; }
+
+    private:
+        std::vector<double> m_drift;
+        std::vector<double> m_diffusion;
+        double m_discount;
+    };
+
+}
+#endif // GREEKCORE_TIMEGRID_H
@@ -77,15 +77,35 @@ namespace GreekCore {
          */
         [[nodiscard]] double getZeroRate(double t) const;
 
+        /**
+         * @brief Sensitivities of the bootstrapped pillars to the instrument quotes.
+         *
+         * Element [k][q] is $\partial \ln P(0, t_k) / \partial R_q$, where pillar 0 is the
+         * reference date and pillar k the maturity of instrument k - 1. Obtained at each bootstrap
+         * root by the implicit function theorem, the partial derivatives of the instrument pricer
+         * being computed by AAD (see AAD.h).
+         */
+        [[nodiscard]] const std::vector<std::vector<double>>& getQuoteJacobian() const { return quote_jacobian_; }
+
+        /**
+         * @brief $\partial P(0, t) / \partial R_q$ for every instrument quote q.
+         * Assumes the interpolation is linear in the log discount factors (as LinearInterpolator).
+         */
+        [[nodiscard]] std::vector<double> getDiscountFactorSensitivities(double t) const;
+
     private:
         Date ref_date_;
         std::vector<double> times_;    // Grid points (x) - Year Fractions
         std::vector<double> log_dfs_;  // Log Discount Factors (y)
+        std::vector<std::vector<double>> quote_jacobian_; // d log_dfs_[k] / d rate_q
         
         DC day_count_convention_;
         Interp interpolator_;
 
         void bootstrapPoint(const CurveInput& instr, double T);
+
+        // Weights w_j such that the interpolated log discount factor at t is sum_j w_j * log_dfs_[j].
+        std::vector<double> interpolationWeights(double t) const;
     };
 
     // Deduction Guide: Allows YieldCurve(date, instruments) to deduce default template args
@@ -0,0 +1,96 @@
+#ifndef GREEKCORE_THREADPOOL_H
+#define GREEKCORE_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace GreekCore {
+
+    /**
+     * @brief Work-stealing thread pool used by the asynchronous and parallel pricers.
+     *
+     * Each worker owns a task deque: tasks submitted from a worker go to the back of its own
+     * deque and are taken back LIFO (cache-warm sub-tasks), while idle workers steal from the
+     * front of the others' deques. Tasks submitted from other threads enter a shared injection
+     * queue. Threads waiting for sub-tasks should help (helpUntil()) rather than block, so
+     * nested parallelism never deadlocks, even on a single worker.
+     */
+    class ThreadPool {
+    public:
+        /**
+         * @param threads Number of workers (0 = std::thread::hardware_concurrency()).
+         */
+        explicit ThreadPool(size_t threads = 0);
+
+        /// Runs every task already submitted, then joins the workers.
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * @brief The library-owned pool (hardware_concurrency() workers), created on first use.
+         */
+        static ThreadPool& global();
+
+        size_t size() const { return m_workers.size(); }
+
+        /// Queues a task; exceptions escaping it terminate the program (use submit() for results).
+        void execute(std::function<void()> task);
+
+        /// Queues `f` and returns a future of its result (or exception).
+        template<typename F>
+        auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+            using R = std::invoke_result_t<std::decay_t<F>>;
+            auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+            std::future<R> result = task->get_future();
+            execute([task]() { (*task)(); });
+            return result;
+        }
+
+        /**
+         * @brief Runs one queued task on the calling thread, if any.
+         * @return false if every queue was empty.
+         */
+        bool tryRunPendingTask();
+
+        /**
+         * @brief Runs queued tasks on the calling thread until `done()` holds.
+         */
+        template<typename Predicate>
+        void helpUntil(Predicate&& done) {
+            while (!done()) {
+                if (!tryRunPendingTask()) std::this_thread::yield();
+            }
+        }
+
+    private:
+        struct alignas(64) TaskQueue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        std::vector<std::unique_ptr<TaskQueue>> m_queues; // one per worker, then the injection queue
+        std::vector<std::jthread> m_workers;
+        std::atomic<size_t> m_pending{0};
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake;
+        bool m_stop = false;
+
+        size_t injectionQueue() const { return m_queues.size() - 1; }
+        size_t localQueue() const; // the caller's own deque, or the injection queue
+        bool popTask(size_t self, std::function<void()>& task);
+        void workerLoop(size_t index);
+    };
+
+}
+#endif // GREEKCORE_THREADPOOL_H
@@ -0,0 +1,20 @@
+#include "GreekCore/Numerics/AAD.h"
+
+namespace GreekCore {
+
+    void Tape::resetAdjoints() {
+        for (size_t i = 0; i < m_size; ++i) node(i).adjoint = 0.0;
+    }
+
+    void Tape::propagate(size_t begin, size_t end) {
+        for (size_t i = end; i-- > begin;) {
+            const Node& n = node(i);
+            const double adjoint = n.adjoint;
+            if (adjoint == 0.0) continue;
+            for (uint32_t k = 0; k < n.n_args; ++k) {
+                node(n.arg[k]).adjoint += n.partial[k] * adjoint;
+            }
+        }
+    }
+
+}
@@ -0,0 +1,236 @@
+#ifndef GREEKCORE_BOXMULLERKERNEL_H
+#define GREEKCORE_BOXMULLERKERNEL_H
+
+/**
+ * @file BoxMullerKernel.h
+ * @brief Private, instruction-set agnostic Box-Muller kernel.
+ *
+ * The kernel is written once against the ops interface of SimdOps.h and instantiated per
+ * instruction set in translation units compiled with the matching flags (see
+ * NormalGeneratorAVX2.cpp, ...).
+ *
+ * `log` and `sin`/`cos` use the fdlibm polynomials (errors below 1 ulp on the reduced
+ * ranges). No FMA is used and every lane performs the same operations in the same order,
+ * hence all instruction sets produce bit-identical output.
+ *
+ * The single precision kernel uses the Cephes `logf` / `sinf` / `cosf` polynomials and
+ * 23-bit uniforms, two per 64-bit draw; u1 >= 2^-23 bounds its normals by
+ * $\sqrt{46 \ln 2} \approx 5.65$ in absolute value (a tail of probability 1.6e-8).
+ */
+
+#include "SimdOps.h"
+
+namespace GreekCore::detail {
+namespace {
+
+    /// Natural log for x in (0, 1]: k*ln2 + log(m), m in [sqrt(1/2), sqrt(2)).
+    template<typename V>
+    FORCE_INLINE typename V::D logKernel(typename V::D x) {
+        using D = typename V::D;
+        using I = typename V::I;
+
+        const I bits = V::asBits(x);
+        const I exponent = V::template srl<52>(bits); // sign bit is zero
+        D m = V::asDouble(V::or_(V::and_(bits, V::set1i(0x000FFFFFFFFFFFFFULL)),
+                                 V::set1i(0x3FF0000000000000ULL)));
+
+        const auto big = V::gt(m, V::set1(1.41421356237309504880));
+        m = V::select(big, V::mul(m, V::set1(0.5)), m);
+
+        // Integer -> double without a conversion instruction: OR into the mantissa of 2^52.
+        D k = V::sub(V::asDouble(V::or_(exponent, V::set1i(0x4330000000000000ULL))),
+                     V::set1(4503599627370496.0 + 1023.0));
+        k = V::add(k, V::select(big, V::set1(1.0), V::set1(0.0)));
+
+        const D f = V::sub(m, V::set1(1.0));
+        const D s = V::div(f, V::add(V::set1(2.0), f));
+        const D z = V::mul(s, s);
+        const D w = V::mul(z, z);
+        const D t1 = V::mul(w, V::add(V::set1(3.999999999940941908e-01),
+                               V::mul(w, V::add(V::set1(2.222219843214978396e-01),
+                               V::mul(w, V::set1(1.531383769920937332e-01))))));
+        const D t2 = V::mul(z, V::add(V::set1(6.666666666666735130e-01),
+                               V::mul(w, V::add(V::set1(2.857142874366239149e-01),
+                               V::mul(w, V::add(V::set1(1.818357216161805012e-01),
+                               V::mul(w, V::set1(1.479819860511658591e-01))))))));
+        const D R = V::add(t2, t1);
+        const D hfsq = V::mul(V::set1(0.5), V::mul(f, f));
+
+        // k*ln2_hi - ((hfsq - (s*(hfsq+R) + k*ln2_lo)) - f)
+        const D inner = V::add(V::mul(s, V::add(hfsq, R)), V::mul(k, V::set1(1.90821492927058770002e-10)));
+        return V::sub(V::mul(k, V::set1(6.93147180369123816490e-01)), V::sub(V::sub(hfsq, inner), f));
+    }
+
+    /// sin(2*pi*u) and cos(2*pi*u) for u in [0, 1), reduced exactly to |x| <= pi/4.
+    template<typename V>
+    FORCE_INLINE void sinCos2PiKernel(typename V::D u, typename V::D& sin_out, typename V::D& cos_out) {
+        using D = typename V::D;
+        using I = typename V::I;
+
+        // q = round(4u) sits in the low mantissa bits of t. u - q/4 is exact (u has 52 fractional bits).
+        const D shifter = V::set1(6755399441055744.0); // 1.5 * 2^52
+        const D t = V::add(V::mul(u, V::set1(4.0)), shifter);
+        const I q = V::asBits(t);
+        const D f = V::sub(u, V::mul(V::sub(t, shifter), V::set1(0.25)));
+        const D x = V::mul(f, V::set1(6.28318530717958647693));
+        const D z = V::mul(x, x);
+
+        const D rs = V::add(V::set1(8.33333333332248946124e-03),
+                     V::mul(z, V::add(V::set1(-1.98412698298579493134e-04),
+                     V::mul(z, V::add(V::set1(2.75573137070700676789e-06),
+                     V::mul(z, V::add(V::set1(-2.50507602534068634195e-08),
+                     V::mul(z, V::set1(1.58969099521155010221e-10)))))))));
+        const D sin_x = V::add(x, V::mul(V::mul(z, x), V::add(V::set1(-1.66666666666666324348e-01), V::mul(z, rs))));
+
+        const D rc = V::mul(z, V::add(V::set1(4.16666666666666019037e-02),
+                     V::mul(z, V::add(V::set1(-1.38888888888741095749e-03),
+                     V::mul(z, V::add(V::set1(2.48015872894767294178e-05),
+                     V::mul(z, V::add(V::set1(-2.75573143513906633035e-07),
+                     V::mul(z, V::add(V::set1(2.08757232129817482790e-09),
+                     V::mul(z, V::set1(-1.13596475577881948265e-11))))))))))));
+        const D cos_x = V::add(V::sub(V::set1(1.0), V::mul(V::set1(0.5), z)), V::mul(z, rc));
+
+        // Odd quadrants swap sin/cos; sin is negated in quadrants 2,3 and cos in quadrants 1,2.
+        const I swap = V::subi(V::set1i(0), V::and_(q, V::set1i(1)));
+        const I sin_bits = V::or_(V::and_(swap, V::asBits(cos_x)), V::andnot(swap, V::asBits(sin_x)));
+        const I cos_bits = V::or_(V::and_(swap, V::asBits(sin_x)), V::andnot(swap, V::asBits(cos_x)));
+        const I sin_sign = V::template sll<62>(V::and_(q, V::set1i(2)));
+        const I cos_sign = V::template sll<62>(V::and_(V::addi(q, V::set1i(1)), V::set1i(2)));
+
+        sin_out = V::asDouble(V::xor_(sin_bits, sin_sign));
+        cos_out = V::asDouble(V::xor_(cos_bits, cos_sign));
+    }
+
+    template<typename V>
+    FORCE_INLINE void boxMullerStep(const uint64_t* u1_bits, const uint64_t* u2_bits, double* cos_out, double* sin_out) {
+        using D = typename V::D;
+        using I = typename V::I;
+
+        // Top 52 bits as a double in [1, 2): u1 = 2 - d in (0, 1] (never zero), u2 = d - 1 in [0, 1).
+        const I one_bits = V::set1i(0x3FF0000000000000ULL);
+        const D d1 = V::asDouble(V::or_(V::template srl<12>(V::load(u1_bits)), one_bits));
+        const D d2 = V::asDouble(V::or_(V::template srl<12>(V::load(u2_bits)), one_bits));
+        const D u1 = V::sub(V::set1(2.0), d1);
+        const D u2 = V::sub(d2, V::set1(1.0));
+
+        const D radius = V::sqrt(V::mul(V::set1(-2.0), logKernel<V>(u1)));
+        D s, c;
+        sinCos2PiKernel<V>(u2, s, c);
+
+        V::store(cos_out, V::mul(radius, c));
+        V::store(sin_out, V::mul(radius, s));
+    }
+
+    template<typename V>
+    FORCE_INLINE void boxMullerKernel(const uint64_t* u1_bits, const uint64_t* u2_bits,
+                                      double* cos_out, double* sin_out, size_t pairs) {
+        size_t i = 0;
+        for (; i + V::width <= pairs; i += V::width) {
+            boxMullerStep<V>(u1_bits + i, u2_bits + i, cos_out + i, sin_out + i);
+        }
+        for (; i < pairs; ++i) {
+            boxMullerStep<ScalarOps>(u1_bits + i, u2_bits + i, cos_out + i, sin_out + i);
+        }
+    }
+
+    /// Single precision natural log for x in (0, 1]: k*ln2 + log(m), m in [sqrt(1/2), sqrt(2)).
+    template<typename V>
+    FORCE_INLINE typename V::D logFloatKernel(typename V::D x) {
+        using D = typename V::D;
+        using I = typename V::I;
+
+        const I bits = V::asBits(x);
+        const I exponent = V::template srl<23>(bits); // sign bit is zero
+        D m = V::asFloat(V::or_(V::and_(bits, V::set1i(0x007FFFFFU)), V::set1i(0x3F800000U)));
+
+        const auto big = V::gt(m, V::set1(1.41421356237309504880f));
+        m = V::select(big, V::mul(m, V::set1(0.5f)), m);
+
+        // Integer -> float: OR into the mantissa of 2^23.
+        D k = V::sub(V::asFloat(V::or_(exponent, V::set1i(0x4B000000U))), V::set1(8388608.0f + 127.0f));
+        k = V::add(k, V::select(big, V::set1(1.0f), V::set1(0.0f)));
+
+        const D f = V::sub(m, V::set1(1.0f));
+        const D z = V::mul(f, f);
+        const D p = V::add(V::set1(3.3333331174e-1f),
+                    V::mul(f, V::add(V::set1(-2.4999993993e-1f),
+                    V::mul(f, V::add(V::set1(2.0000714765e-1f),
+                    V::mul(f, V::add(V::set1(-1.6668057665e-1f),
+                    V::mul(f, V::add(V::set1(1.4249322787e-1f),
+                    V::mul(f, V::add(V::set1(-1.2420140846e-1f),
+                    V::mul(f, V::add(V::set1(1.1676998740e-1f),
+                    V::mul(f, V::add(V::set1(-1.1514610310e-1f),
+                    V::mul(f, V::set1(7.0376836292e-2f)))))))))))))))));
+
+        // f + (f*z*p + k*ln2_lo - z/2) + k*ln2_hi
+        D y = V::add(V::mul(V::mul(f, z), p), V::mul(k, V::set1(-2.12194440e-4f)));
+        y = V::sub(y, V::mul(V::set1(0.5f), z));
+        return V::add(V::add(f, y), V::mul(k, V::set1(0.693359375f)));
+    }
+
+    /// Single precision sin(2*pi*u) and cos(2*pi*u) for u in [0, 1), reduced exactly to |x| <= pi/4.
+    template<typename V>
+    FORCE_INLINE void sinCos2PiFloatKernel(typename V::D u, typename V::D& sin_out, typename V::D& cos_out) {
+        using D = typename V::D;
+        using I = typename V::I;
+
+        const D shifter = V::set1(12582912.0f); // 1.5 * 2^23
+        const D t = V::add(V::mul(u, V::set1(4.0f)), shifter);
+        const I q = V::asBits(t);
+        const D f = V::sub(u, V::mul(V::sub(t, shifter), V::set1(0.25f)));
+        const D x = V::mul(f, V::set1(6.28318530717958647693f));
+        const D z = V::mul(x, x);
+
+        const D sin_x = V::add(x, V::mul(V::mul(x, z), V::add(V::set1(-1.6666654611e-1f),
+                                  V::mul(z, V::add(V::set1(8.3321608736e-3f),
+                                  V::mul(z, V::set1(-1.9515295891e-4f)))))));
+        const D cos_x = V::add(V::sub(V::set1(1.0f), V::mul(V::set1(0.5f), z)),
+                               V::mul(V::mul(z, z), V::add(V::set1(4.166664568298827e-2f),
+                               V::mul(z, V::add(V::set1(-1.388731625493765e-3f),
+                               V::mul(z, V::set1(2.443315711809948e-5f)))))));
+
+        const I swap = V::subi(V::set1i(0), V::and_(q, V::set1i(1)));
+        const I sin_bits = V::or_(V::and_(swap, V::asBits(cos_x)), V::andnot(swap, V::asBits(sin_x)));
+        const I cos_bits = V::or_(V::and_(swap, V::asBits(sin_x)), V::andnot(swap, V::asBits(cos_x)));
+        const I sin_sign = V::template sll<30>(V::and_(q, V::set1i(2)));
+        const I cos_sign = V::template sll<30>(V::and_(V::addi(q, V::set1i(1)), V::set1i(2)));
+
+        sin_out = V::asFloat(V::xor_(sin_bits, sin_sign));
+        cos_out = V::asFloat(V::xor_(cos_bits, cos_sign));
+    }
+
+    template<typename V>
+    FORCE_INLINE void boxMullerFloatStep(const uint32_t* u1_bits, const uint32_t* u2_bits, float* cos_out, float* sin_out) {
+        using D = typename V::D;
+        using I = typename V::I;
+
+        // Top 23 bits as a float in [1, 2): u1 = 2 - d in (0, 1], u2 = d - 1 in [0, 1).
+        const I one_bits = V::set1i(0x3F800000U);
+        const D d1 = V::asFloat(V::or_(V::template srl<9>(V::load(u1_bits)), one_bits));
+        const D d2 = V::asFloat(V::or_(V::template srl<9>(V::load(u2_bits)), one_bits));
+        const D u1 = V::sub(V::set1(2.0f), d1);
+        const D u2 = V::sub(d2, V::set1(1.0f));
+
+        const D radius = V::sqrt(V::mul(V::set1(-2.0f), logFloatKernel<V>(u1)));
+        D s, c;
+        sinCos2PiFloatKernel<V>(u2, s, c);
+
+        V::store(cos_out, V::mul(radius, c));
+        V::store(sin_out, V::mul(radius, s));
+    }
+
+    template<typename V>
+    FORCE_INLINE void boxMullerFloatKernel(const uint32_t* u1_bits, const uint32_t* u2_bits,
+                                           float* cos_out, float* sin_out, size_t pairs) {
+        size_t i = 0;
+        for (; i + V::width <= pairs; i += V::width) {
+            boxMullerFloatStep<V>(u1_bits + i, u2_bits + i, cos_out + i, sin_out + i);
+        }
+        for (; i < pairs; ++i) {
+            boxMullerFloatStep<ScalarFloatOps>(u1_bits + i, u2_bits + i, cos_out + i, sin_out + i);
+        }
+    }
+
+}
+}
+#endif // GREEKCORE_BOXMULLERKERNEL_H
@@ -0,0 +1,83 @@
+#include "GreekCore/Numerics/BrownianBridge.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace GreekCore {
+
+    BrownianBridge::BrownianBridge(std::span<const double> times) : m_size(times.size()) {
+        initialize(times);
+    }
+
+    BrownianBridge::BrownianBridge(size_t steps) : m_size(steps) {
+        std::vector<double> times(steps);
+        for (size_t j = 0; j < steps; ++j) times[j] = static_cast<double>(j + 1) / steps;
+        initialize(times);
+    }
+
+    void BrownianBridge::initialize(std::span<const double> t) {
+        const size_t n = m_size;
+        if (n == 0) throw std::invalid_argument("Brownian bridge needs at least one time");
+        for (size_t j = 0; j < n; ++j) {
+            double prev = (j == 0) ? 0.0 : t[j - 1];
+            if (!(t[j] > prev)) throw std::invalid_argument("Brownian bridge times must be strictly increasing");
+        }
+
+        m_bridgeIndex.assign(n, 0);
+        m_leftIndex.assign(n, 0);
+        m_rightIndex.assign(n, 0);
+        m_leftWeight.assign(n, 0.0);
+        m_rightWeight.assign(n, 0.0);
+        m_stdDev.assign(n, 0.0);
+        m_invSqrtDt.resize(n);
+
+        for (size_t j = 0; j < n; ++j) {
+            m_invSqrtDt[j] = 1.0 / std::sqrt(t[j] - (j == 0 ? 0.0 : t[j - 1]));
+        }
+
+        // map[i] != 0 once W(t_i) has been constructed (stores the construction order).
+        std::vector<size_t> map(n, 0);
+        map[n - 1] = 1;
+        m_bridgeIndex[0] = n - 1;
+        m_stdDev[0] = std::sqrt(t[n - 1]);
+
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            while (map[j]) ++j;            // first unpopulated point
+            size_t k = j;
+            while (!map[k]) ++k;           // next populated point to its right
+            const size_t l = j + ((k - 1 - j) >> 1); // bisect
+
+            map[l] = i;
+            m_bridgeIndex[i] = l;
+            m_leftIndex[i] = j;
+            m_rightIndex[i] = k;
+
+            const double t_left = (j == 0) ? 0.0 : t[j - 1];
+            m_leftWeight[i] = (t[k] - t[l]) / (t[k] - t_left);
+            m_rightWeight[i] = (t[l] - t_left) / (t[k] - t_left);
+            m_stdDev[i] = std::sqrt((t[l] - t_left) * (t[k] - t[l]) / (t[k] - t_left));
+
+            j = k + 1;
+            if (j >= n) j = 0;
+        }
+    }
+
+    void BrownianBridge::transform(std::span<const double> z, std::span<double> out) const {
+        const size_t n = m_size;
+
+        // Build W(t_j) in out, then difference in place.
+        out[n - 1] = m_stdDev[0] * z[0];
+        for (size_t i = 1; i < n; ++i) {
+            const size_t j = m_leftIndex[i];
+            const size_t k = m_rightIndex[i];
+            const size_t l = m_bridgeIndex[i];
+            const double left = (j == 0) ? 0.0 : out[j - 1];
+            out[l] = m_leftWeight[i] * left + m_rightWeight[i] * out[k] + m_stdDev[i] * z[i];
+        }
+
+        for (size_t j = n - 1; j > 0; --j) {
+            out[j] = (out[j] - out[j - 1]) * m_invSqrtDt[j];
+        }
+        out[0] *= m_invSqrtDt[0];
+    }
+
+}
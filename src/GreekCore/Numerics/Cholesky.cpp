@@ -0,0 +1,37 @@
+#include "GreekCore/Numerics/Cholesky.h"
+#include "GreekCore/Numerics/VectorMath.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace GreekCore {
+
+    CholeskyFactor::CholeskyFactor(std::span<const double> matrix, size_t n) : m_n(n), m_lower(n * n, 0.0) {
+        if (matrix.size() != n * n) throw std::invalid_argument("Cholesky needs an n x n matrix");
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                double sum = matrix[i * n + j];
+                for (size_t k = 0; k < j; ++k) sum -= m_lower[i * n + k] * m_lower[j * n + k];
+                if (i == j) {
+                    if (!(sum > 0.0)) throw std::invalid_argument("Cholesky needs a positive definite matrix");
+                    m_lower[i * n + i] = std::sqrt(sum);
+                } else {
+                    m_lower[i * n + j] = sum / m_lower[j * n + j];
+                }
+            }
+        }
+    }
+
+    void CholeskyFactor::multiply(std::span<const double> z, std::span<double> x) const {
+        for (size_t i = 0; i < m_n; ++i) {
+            double sum = 0.0;
+            for (size_t j = 0; j <= i; ++j) sum += m_lower[i * m_n + j] * z[j];
+            x[i] = sum;
+        }
+    }
+
+    void CholeskyFactor::multiplyBlock(std::span<const double> z, std::span<double> x, size_t block) const {
+        lowerTriangularMultiply(m_lower, m_n, z, x, block);
+    }
+
+}
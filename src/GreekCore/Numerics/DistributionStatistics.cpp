@@ -0,0 +1,330 @@
+#include "GreekCore/Numerics/DistributionStatistics.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace GreekCore {
+
+    // ---------------------------------------------------------------- P2Quantile
+
+    P2Quantile::P2Quantile(double probability)
+        : m_p(probability), m_increment{0.0, probability / 2.0, probability, (1.0 + probability) / 2.0, 1.0} {
+        if (!(probability > 0.0 && probability < 1.0)) {
+            throw std::invalid_argument("P2Quantile: probability must be in (0, 1)");
+        }
+    }
+
+    void P2Quantile::add(double x) {
+        if (m_count < 5) {
+            m_height[m_count++] = x;
+            if (m_count == 5) {
+                std::sort(m_height.begin(), m_height.end());
+                for (size_t i = 0; i < 5; ++i) {
+                    m_position[i] = static_cast<double>(i);
+                    m_desired[i] = 4.0 * m_increment[i];
+                }
+            }
+            return;
+        }
+
+        // Cell k such that q_k <= x < q_{k+1}, extending the extreme markers if needed.
+        size_t k;
+        if (x < m_height[0]) {
+            m_height[0] = x;
+            k = 0;
+        } else if (x >= m_height[4]) {
+            m_height[4] = std::max(m_height[4], x);
+            k = 3;
+        } else {
+            k = 0;
+            while (x >= m_height[k + 1]) ++k;
+        }
+        ++m_count;
+        for (size_t i = k + 1; i < 5; ++i) m_position[i] += 1.0;
+        for (size_t i = 0; i < 5; ++i) m_desired[i] += m_increment[i];
+
+        // Move the middle markers towards their desired positions (parabolic, else linear).
+        for (size_t i = 1; i < 4; ++i) {
+            const double d = m_desired[i] - m_position[i];
+            if ((d >= 1.0 && m_position[i + 1] - m_position[i] > 1.0) ||
+                (d <= -1.0 && m_position[i - 1] - m_position[i] < -1.0)) {
+                const double s = d > 0.0 ? 1.0 : -1.0;
+                const double n_lo = m_position[i - 1], n = m_position[i], n_hi = m_position[i + 1];
+                const double q_lo = m_height[i - 1], q = m_height[i], q_hi = m_height[i + 1];
+
+                double candidate = q + s / (n_hi - n_lo) *
+                    ((n - n_lo + s) * (q_hi - q) / (n_hi - n) + (n_hi - n - s) * (q - q_lo) / (n - n_lo));
+                if (!(q_lo < candidate && candidate < q_hi)) {
+                    const size_t j = s > 0.0 ? i + 1 : i - 1;
+                    candidate = q + s * (m_height[j] - q) / (m_position[j] - n);
+                }
+                m_height[i] = candidate;
+                m_position[i] += s;
+            }
+        }
+    }
+
+    double P2Quantile::rank(double x) const {
+        if (x <= m_height[0]) return 0.0;
+        if (x >= m_height[4]) return m_position[4];
+        size_t i = 0;
+        while (x > m_height[i + 1]) ++i;
+        const double span = m_height[i + 1] - m_height[i];
+        const double f = span > 0.0 ? (x - m_height[i]) / span : 1.0;
+        return m_position[i] + f * (m_position[i + 1] - m_position[i]);
+    }
+
+    void P2Quantile::merge(const P2Quantile& other) {
+        if (other.m_count < 5) {
+            for (uint64_t i = 0; i < other.m_count; ++i) add(other.m_height[i]);
+            return;
+        }
+        if (m_count < 5) {
+            const std::array<double, 5> own = m_height;
+            const uint64_t own_count = m_count;
+            *this = P2Quantile(m_p);
+            m_height = other.m_height;
+            m_position = other.m_position;
+            m_desired = other.m_desired;
+            m_count = other.m_count;
+            for (uint64_t i = 0; i < own_count; ++i) add(own[i]);
+            return;
+        }
+
+        // Merged rank of x: sum of both interpolated ranks (+1: two 0-based ranks).
+        std::array<double, 10> candidates;
+        std::copy(m_height.begin(), m_height.end(), candidates.begin());
+        std::copy(other.m_height.begin(), other.m_height.end(), candidates.begin() + 5);
+        std::sort(candidates.begin(), candidates.end());
+        std::array<double, 10> merged_rank;
+        for (size_t c = 0; c < 10; ++c) {
+            merged_rank[c] = std::min(rank(candidates[c]) + other.rank(candidates[c]) + 1.0,
+                                      static_cast<double>(m_count + other.m_count - 1));
+        }
+        merged_rank[0] = 0.0;
+
+        const uint64_t total = m_count + other.m_count;
+        std::array<double, 5> height;
+        height[0] = candidates[0];
+        height[4] = candidates[9];
+        for (size_t i = 1; i < 4; ++i) {
+            const double target = static_cast<double>(total - 1) * m_increment[i];
+            size_t c = 1;
+            while (c < 9 && merged_rank[c] < target) ++c;
+            const double span = merged_rank[c] - merged_rank[c - 1];
+            const double f = span > 0.0 ? (target - merged_rank[c - 1]) / span : 1.0;
+            height[i] = candidates[c - 1] + std::clamp(f, 0.0, 1.0) * (candidates[c] - candidates[c - 1]);
+        }
+
+        m_count = total;
+        m_height = height;
+        for (size_t i = 0; i < 5; ++i) m_desired[i] = static_cast<double>(total - 1) * m_increment[i];
+        // Integer positions, strictly increasing, as close as possible to the desired ones.
+        m_position[0] = 0.0;
+        m_position[4] = static_cast<double>(total - 1);
+        for (size_t i = 1; i < 4; ++i) {
+            m_position[i] = std::clamp(std::round(m_desired[i]), m_position[i - 1] + 1.0,
+                                       static_cast<double>(total - 1) - static_cast<double>(4 - i));
+        }
+    }
+
+    double P2Quantile::value() const {
+        if (m_count == 0) return 0.0;
+        if (m_count >= 5) return m_height[2];
+
+        // Few results: interpolate the sorted sample directly.
+        std::array<double, 5> sorted = m_height;
+        std::sort(sorted.begin(), sorted.begin() + m_count);
+        const double r = m_p * static_cast<double>(m_count - 1);
+        const size_t lo = static_cast<size_t>(r);
+        const size_t hi = std::min<size_t>(lo + 1, m_count - 1);
+        return sorted[lo] + (r - static_cast<double>(lo)) * (sorted[hi] - sorted[lo]);
+    }
+
+    // ---------------------------------------------------------------- StatisticsP2Quantile
+
+    StatisticsP2Quantile::StatisticsP2Quantile(const std::vector<double>& probabilities) {
+        m_quantiles.reserve(probabilities.size());
+        for (double p : probabilities) m_quantiles.emplace_back(p);
+    }
+
+    void StatisticsP2Quantile::dumpOneResult(double result) {
+        m_moments.add(result);
+        for (auto& q : m_quantiles) q.add(result);
+    }
+
+    std::vector<std::vector<double>> StatisticsP2Quantile::getResultsSoFar() const {
+        GathererSnapshot snap;
+        snapshot(snap);
+        std::vector<std::vector<double>> results{{snap.mean, snap.std_error}};
+        for (const auto& q : m_quantiles) results.push_back({q.probability(), q.value()});
+        return results;
+    }
+
+    void StatisticsP2Quantile::merge(const StatisticsP2Quantile& other) {
+        if (other.m_quantiles.size() != m_quantiles.size()) {
+            throw std::invalid_argument("StatisticsP2Quantile::merge: different probabilities");
+        }
+        m_moments.merge(other.m_moments);
+        for (size_t i = 0; i < m_quantiles.size(); ++i) m_quantiles[i].merge(other.m_quantiles[i]);
+    }
+
+    // ---------------------------------------------------------------- StatisticsHistogram
+
+    StatisticsHistogram::StatisticsHistogram(double min_magnitude, double max_magnitude, size_t buckets_per_decade)
+        : m_min_magnitude(min_magnitude), m_max_magnitude(max_magnitude), m_buckets_per_decade(buckets_per_decade),
+          m_min(0.0), m_max(0.0) {
+        if (!(min_magnitude > 0.0 && max_magnitude > min_magnitude) || buckets_per_decade == 0) {
+            throw std::invalid_argument("StatisticsHistogram: need 0 < min_magnitude < max_magnitude and buckets_per_decade > 0");
+        }
+        m_side = static_cast<size_t>(std::ceil(std::log10(max_magnitude / min_magnitude) * buckets_per_decade));
+        // [negative overflow][negative log buckets][|x| < min][positive log buckets][positive overflow]
+        m_counts.assign(2 * m_side + 3, 0);
+        m_sums.assign(2 * m_side + 3, 0.0);
+    }
+
+    double StatisticsHistogram::edge(size_t k) const {
+        if (k >= m_side) return m_max_magnitude;
+        return m_min_magnitude * std::pow(10.0, static_cast<double>(k) / static_cast<double>(m_buckets_per_decade));
+    }
+
+    size_t StatisticsHistogram::bucketOf(double x) const {
+        const double a = std::abs(x);
+        if (a < m_min_magnitude) return m_side + 1;
+        if (a >= m_max_magnitude) return x > 0.0 ? 2 * m_side + 2 : 0;
+
+        double scaled = std::log10(a / m_min_magnitude) * static_cast<double>(m_buckets_per_decade);
+        size_t k = std::min(static_cast<size_t>(std::max(scaled, 0.0)), m_side - 1);
+        // Keep the bucket consistent with edge() despite rounding in log10 / pow.
+        if (k > 0 && a < edge(k)) --k;
+        else if (k + 1 < m_side && a >= edge(k + 1)) ++k;
+
+        return x > 0.0 ? m_side + 2 + k : m_side - k;
+    }
+
+    double StatisticsHistogram::bucketLower(size_t i) const {
+        if (i == 0) return m_min;
+        if (i <= m_side) return -edge(m_side - i + 1);
+        if (i == m_side + 1) return -m_min_magnitude;
+        if (i <= 2 * m_side + 1) return edge(i - m_side - 2);
+        return m_max_magnitude;
+    }
+
+    double StatisticsHistogram::bucketUpper(size_t i) const {
+        if (i == 0) return -m_max_magnitude;
+        if (i <= m_side) return -edge(m_side - i);
+        if (i == m_side + 1) return m_min_magnitude;
+        if (i <= 2 * m_side + 1) return edge(i - m_side - 1);
+        return m_max;
+    }
+
+    void StatisticsHistogram::dumpOneResult(double result) {
+        if (m_moments.count == 0) {
+            m_min = m_max = result;
+        } else {
+            m_min = std::min(m_min, result);
+            m_max = std::max(m_max, result);
+        }
+        m_moments.add(result);
+        const size_t i = bucketOf(result);
+        ++m_counts[i];
+        m_sums[i] += result;
+    }
+
+    void StatisticsHistogram::merge(const StatisticsHistogram& other) {
+        if (other.m_counts.size() != m_counts.size() || other.m_min_magnitude != m_min_magnitude ||
+            other.m_buckets_per_decade != m_buckets_per_decade) {
+            throw std::invalid_argument("StatisticsHistogram::merge: different bucket layouts");
+        }
+        if (other.m_moments.count == 0) return;
+        if (m_moments.count == 0) {
+            m_min = other.m_min;
+            m_max = other.m_max;
+        } else {
+            m_min = std::min(m_min, other.m_min);
+            m_max = std::max(m_max, other.m_max);
+        }
+        m_moments.merge(other.m_moments);
+        for (size_t i = 0; i < m_counts.size(); ++i) {
+            m_counts[i] += other.m_counts[i];
+            m_sums[i] += other.m_sums[i];
+        }
+    }
+
+    double StatisticsHistogram::quantile(double p) const {
+        const uint64_t n = m_moments.count;
+        if (n == 0) return 0.0;
+        const double target = std::clamp(p, 0.0, 1.0) * static_cast<double>(n);
+
+        double cumulative = 0.0;
+        for (size_t i = 0; i < m_counts.size(); ++i) {
+            const double c = static_cast<double>(m_counts[i]);
+            if (c == 0.0) continue;
+            if (cumulative + c >= target) {
+                const double lo = std::max(bucketLower(i), m_min);
+                const double hi = std::min(bucketUpper(i), m_max);
+                return lo + (target - cumulative) / c * (hi - lo);
+            }
+            cumulative += c;
+        }
+        return m_max;
+    }
+
+    double StatisticsHistogram::lowerTailMean(double p) const {
+        const uint64_t n = m_moments.count;
+        if (n == 0) return 0.0;
+        const double target = std::clamp(p, 0.0, 1.0) * static_cast<double>(n);
+        if (target <= 0.0) return m_min;
+
+        double cumulative = 0.0;
+        double sum = 0.0;
+        for (size_t i = 0; i < m_counts.size(); ++i) {
+            const double c = static_cast<double>(m_counts[i]);
+            if (c == 0.0) continue;
+            if (cumulative + c >= target) {
+                // Partial bucket: its share of the tail at the bucket mean.
+                sum += m_sums[i] * (target - cumulative) / c;
+                return sum / target;
+            }
+            sum += m_sums[i];
+            cumulative += c;
+        }
+        return sum / cumulative;
+    }
+
+    std::vector<std::vector<double>> StatisticsHistogram::getResultsSoFar() const {
+        GathererSnapshot snap;
+        snapshot(snap);
+        std::vector<std::vector<double>> results{{snap.mean, snap.std_error}};
+        for (size_t i = 0; i < m_counts.size(); ++i) {
+            if (m_counts[i] == 0) continue;
+            results.push_back({std::max(bucketLower(i), m_min), std::min(bucketUpper(i), m_max),
+                               static_cast<double>(m_counts[i])});
+        }
+        return results;
+    }
+
+    // ---------------------------------------------------------------- StatisticsExpectedShortfall
+
+    StatisticsExpectedShortfall::StatisticsExpectedShortfall(const std::vector<double>& confidence_levels,
+                                                             double min_magnitude, double max_magnitude,
+                                                             size_t buckets_per_decade)
+        : m_levels(confidence_levels), m_histogram(min_magnitude, max_magnitude, buckets_per_decade) {
+        for (double level : m_levels) {
+            if (!(level > 0.0 && level < 1.0)) {
+                throw std::invalid_argument("StatisticsExpectedShortfall: confidence levels must be in (0, 1)");
+            }
+        }
+    }
+
+    std::vector<std::vector<double>> StatisticsExpectedShortfall::getResultsSoFar() const {
+        GathererSnapshot snap;
+        snapshot(snap);
+        std::vector<std::vector<double>> results{{snap.mean, snap.std_error}};
+        for (double level : m_levels) {
+            results.push_back({level, m_histogram.valueAtRisk(level), m_histogram.expectedShortfall(level)});
+        }
+        return results;
+    }
+
+}
@@ -0,0 +1,142 @@
+#ifndef GREEKCORE_EXPKERNEL_H
+#define GREEKCORE_EXPKERNEL_H
+
+/**
+ * @file ExpKernel.h
+ * @brief Private, instruction-set agnostic exp kernels (see SimdOps.h and BoxMullerKernel.h).
+ *
+ * `exp` uses the fdlibm argument reduction and a division-free Taylor polynomial (error
+ * below 1 ulp). As for Box-Muller, no FMA is used and every lane performs the same operations
+ * in the same order, hence all instruction sets produce bit-identical output.
+ *
+ * The single precision kernels (on the *FloatOps of SimdOps.h) use the Cephes `expf`
+ * reduction and minimax polynomial (error below 2 ulp) under the same rules.
+ */
+
+#include "SimdOps.h"
+
+namespace GreekCore::detail {
+namespace {
+
+    /// exp(x) for x clamped to [-708, 709]: 2^k * exp(r), |r| <= ln2 / 2.
+    template<typename V>
+    FORCE_INLINE typename V::D expKernel(typename V::D x) {
+        using D = typename V::D;
+
+        x = V::select(V::gt(x, V::set1(709.0)), V::set1(709.0), x);
+        x = V::select(V::gt(V::set1(-708.0), x), V::set1(-708.0), x);
+
+        // k = round(x / ln2) sits in the low mantissa bits of t (same shifter trick as sinCos2PiKernel).
+        const D shifter = V::set1(6755399441055744.0); // 1.5 * 2^52
+        const D t = V::add(V::mul(x, V::set1(1.44269504088896338700e+00)), shifter);
+        const D k = V::sub(t, shifter);
+
+        const D hi = V::sub(x, V::mul(k, V::set1(6.93147180369123816490e-01)));
+        const D lo = V::mul(k, V::set1(1.90821492927058770002e-10));
+        const D r = V::sub(hi, lo);
+        // Taylor polynomial of degree 13 (truncation error below 2^-60 on the reduced range).
+        const D p = V::add(V::set1(1.0 / 2.0),
+                    V::mul(r, V::add(V::set1(1.0 / 6.0),
+                    V::mul(r, V::add(V::set1(1.0 / 24.0),
+                    V::mul(r, V::add(V::set1(1.0 / 120.0),
+                    V::mul(r, V::add(V::set1(1.0 / 720.0),
+                    V::mul(r, V::add(V::set1(1.0 / 5040.0),
+                    V::mul(r, V::add(V::set1(1.0 / 40320.0),
+                    V::mul(r, V::add(V::set1(1.0 / 362880.0),
+                    V::mul(r, V::add(V::set1(1.0 / 3628800.0),
+                    V::mul(r, V::add(V::set1(1.0 / 39916800.0),
+                    V::mul(r, V::add(V::set1(1.0 / 479001600.0),
+                    V::mul(r, V::set1(1.0 / 6227020800.0)))))))))))))))))))))));
+        const D y = V::add(V::set1(1.0), V::mul(r, V::add(V::set1(1.0), V::mul(r, p))));
+
+        // 2^k: the biased exponent k + 1023 shifted into place (the shifter's bits fall off the top).
+        const D scale = V::asDouble(V::template sll<52>(V::addi(V::asBits(t), V::set1i(1023))));
+        return V::mul(y, scale);
+    }
+
+    template<typename V>
+    FORCE_INLINE void expBatchKernel(const double* x, double* out, size_t n) {
+        size_t i = 0;
+        for (; i + V::width <= n; i += V::width) {
+            V::store(out + i, expKernel<V>(V::loadd(x + i)));
+        }
+        for (; i < n; ++i) {
+            ScalarOps::store(out + i, expKernel<ScalarOps>(ScalarOps::loadd(x + i)));
+        }
+    }
+
+    /// spot[i] *= exp(drift + diffusion * z[i])
+    template<typename V>
+    FORCE_INLINE void lognormalStepLanes(double* spot, const double* z, typename V::D drift, typename V::D diffusion) {
+        const auto growth = expKernel<V>(V::add(drift, V::mul(diffusion, V::loadd(z))));
+        V::store(spot, V::mul(V::loadd(spot), growth));
+    }
+
+    template<typename V>
+    FORCE_INLINE void lognormalStepKernel(double* spot, const double* z, size_t n, double drift, double diffusion) {
+        size_t i = 0;
+        for (; i + V::width <= n; i += V::width) {
+            lognormalStepLanes<V>(spot + i, z + i, V::set1(drift), V::set1(diffusion));
+        }
+        for (; i < n; ++i) {
+            lognormalStepLanes<ScalarOps>(spot + i, z + i, drift, diffusion);
+        }
+    }
+
+    /// Single precision exp(x) for x clamped to [-87, 88]: 2^k * exp(r), |r| <= ln2 / 2.
+    template<typename V>
+    FORCE_INLINE typename V::D expFloatKernel(typename V::D x) {
+        using D = typename V::D;
+
+        x = V::select(V::gt(x, V::set1(88.0f)), V::set1(88.0f), x);
+        x = V::select(V::gt(V::set1(-87.0f), x), V::set1(-87.0f), x);
+
+        const D shifter = V::set1(12582912.0f); // 1.5 * 2^23
+        const D t = V::add(V::mul(x, V::set1(1.44269504088896341f)), shifter);
+        const D k = V::sub(t, shifter);
+
+        // ln2 split so that k * 0.693359375 is exact.
+        const D r = V::sub(V::sub(x, V::mul(k, V::set1(0.693359375f))), V::mul(k, V::set1(-2.12194440e-4f)));
+        const D p = V::add(V::set1(5.0000001201e-1f),
+                    V::mul(r, V::add(V::set1(1.6666665459e-1f),
+                    V::mul(r, V::add(V::set1(4.1665795894e-2f),
+                    V::mul(r, V::add(V::set1(8.3334519073e-3f),
+                    V::mul(r, V::add(V::set1(1.3981999507e-3f),
+                    V::mul(r, V::set1(1.9875691500e-4f)))))))))));
+        const D y = V::add(V::add(V::mul(p, V::mul(r, r)), r), V::set1(1.0f));
+
+        const D scale = V::asFloat(V::template sll<23>(V::addi(V::asBits(t), V::set1i(127))));
+        return V::mul(y, scale);
+    }
+
+    template<typename V>
+    FORCE_INLINE void expBatchFloatKernel(const float* x, float* out, size_t n) {
+        size_t i = 0;
+        for (; i + V::width <= n; i += V::width) {
+            V::store(out + i, expFloatKernel<V>(V::loadf(x + i)));
+        }
+        for (; i < n; ++i) {
+            ScalarFloatOps::store(out + i, expFloatKernel<ScalarFloatOps>(ScalarFloatOps::loadf(x + i)));
+        }
+    }
+
+    template<typename V>
+    FORCE_INLINE void lognormalStepFloatLanes(float* spot, const float* z, typename V::D drift, typename V::D diffusion) {
+        const auto growth = expFloatKernel<V>(V::add(drift, V::mul(diffusion, V::loadf(z))));
+        V::store(spot, V::mul(V::loadf(spot), growth));
+    }
+
+    template<typename V>
+    FORCE_INLINE void lognormalStepFloatKernel(float* spot, const float* z, size_t n, float drift, float diffusion) {
+        size_t i = 0;
+        for (; i + V::width <= n; i += V::width) {
+            lognormalStepFloatLanes<V>(spot + i, z + i, V::set1(drift), V::set1(diffusion));
+        }
+        for (; i < n; ++i) {
+            lognormalStepFloatLanes<ScalarFloatOps>(spot + i, z + i, drift, diffusion);
+        }
+    }
+
+}
+}
+#endif // GREEKCORE_EXPKERNEL_H
@@ -0,0 +1,86 @@
+#include "GreekCore/Numerics/LeastSquares.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreekCore {
+
+    void evaluateBasis(RegressionBasis basis, double x, std::span<double> out) {
+        if (out.empty()) return;
+        if (basis == RegressionBasis::Polynomial) {
+            double power = 1.0;
+            for (double& phi : out) {
+                phi = power;
+                power *= x;
+            }
+            return;
+        }
+
+        // Laguerre recurrence: (k + 1) L_{k+1} = (2k + 1 - x) L_k - k L_{k-1}.
+        const double weight = std::exp(-0.5 * x);
+        double previous = 1.0, current = 1.0 - x;
+        out[0] = weight;
+        if (out.size() > 1) out[1] = weight * current;
+        for (size_t k = 1; k + 1 < out.size(); ++k) {
+            const double next = ((2.0 * k + 1.0 - x) * current - k * previous) / (k + 1.0);
+            previous = current;
+            current = next;
+            out[k + 1] = weight * current;
+        }
+    }
+
+    LeastSquares::LeastSquares(size_t regressors)
+        : m_k(regressors), m_gram(regressors * regressors, 0.0), m_rhs(regressors, 0.0) {}
+
+    void LeastSquares::add(std::span<const double> phi, double y) {
+        for (size_t i = 0; i < m_k; ++i) {
+            for (size_t j = 0; j <= i; ++j) m_gram[i * m_k + j] += phi[i] * phi[j];
+            m_rhs[i] += phi[i] * y;
+        }
+        ++m_count;
+    }
+
+    void LeastSquares::merge(const LeastSquares& other) {
+        for (size_t i = 0; i < m_gram.size(); ++i) m_gram[i] += other.m_gram[i];
+        for (size_t i = 0; i < m_k; ++i) m_rhs[i] += other.m_rhs[i];
+        m_count += other.m_count;
+    }
+
+    std::vector<double> LeastSquares::solve() const {
+        // Cholesky G = L L^T; a pivot that is tiny relative to its diagonal entry marks a
+        // dependent regressor, whose row and column are dropped (coefficient 0).
+        constexpr double kRelativePivot = 1e-12;
+        std::vector<double> L(m_k * m_k, 0.0);
+        std::vector<bool> active(m_k, false);
+        for (size_t i = 0; i < m_k; ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                if (!active[j] && j < i) continue;
+                double sum = m_gram[i * m_k + j];
+                for (size_t k = 0; k < j; ++k) sum -= L[i * m_k + k] * L[j * m_k + k];
+                if (j < i) {
+                    L[i * m_k + j] = sum / L[j * m_k + j];
+                } else if (sum > kRelativePivot * m_gram[i * m_k + i] && sum > 0.0) {
+                    L[i * m_k + i] = std::sqrt(sum);
+                    active[i] = true;
+                }
+            }
+            if (!active[i]) std::fill_n(L.begin() + i * m_k, i, 0.0);
+        }
+
+        // Forward then back substitution over the active regressors.
+        std::vector<double> beta(m_k, 0.0);
+        for (size_t i = 0; i < m_k; ++i) {
+            if (!active[i]) continue;
+            double sum = m_rhs[i];
+            for (size_t k = 0; k < i; ++k) sum -= L[i * m_k + k] * beta[k];
+            beta[i] = sum / L[i * m_k + i];
+        }
+        for (size_t i = m_k; i-- > 0;) {
+            if (!active[i]) continue;
+            double sum = beta[i];
+            for (size_t k = i + 1; k < m_k; ++k) sum -= L[k * m_k + i] * beta[k];
+            beta[i] = sum / L[i * m_k + i];
+        }
+        return beta;
+    }
+
+}
@@ -0,0 +1,40 @@
+#ifndef GREEKCORE_LINEARKERNEL_H
+#define GREEKCORE_LINEARKERNEL_H
+
+/**
+ * @file LinearKernel.h
+ * @brief Private linear algebra kernels of VectorMath, written against SimdOps.h.
+ */
+
+#include "SimdOps.h"
+
+namespace GreekCore::detail {
+namespace {
+
+    /**
+     * x = L z for a block of vectors stored factor-major (element i of vector p at [i * block + p]).
+     * Each row accumulates over j in increasing order with separate multiply and add, so every
+     * instruction set rounds alike.
+     */
+    template<typename V>
+    FORCE_INLINE void lowerTriangularKernel(const double* lower, size_t n, const double* z, double* x, size_t block) {
+        for (size_t i = 0; i < n; ++i) {
+            const double* row = lower + i * n;
+            double* out = x + i * block;
+            size_t p = 0;
+            for (; p + V::width <= block; p += V::width) {
+                typename V::D sum = V::mul(V::set1(row[0]), V::loadd(z + p));
+                for (size_t j = 1; j <= i; ++j) sum = V::add(sum, V::mul(V::set1(row[j]), V::loadd(z + j * block + p)));
+                V::store(out + p, sum);
+            }
+            for (; p < block; ++p) {
+                double sum = row[0] * z[p];
+                for (size_t j = 1; j <= i; ++j) sum += row[j] * z[j * block + p];
+                out[p] = sum;
+            }
+        }
+    }
+
+}
+}
+#endif // GREEKCORE_LINEARKERNEL_H
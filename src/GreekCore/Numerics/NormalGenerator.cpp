@@ -0,0 +1,143 @@
+#include "GreekCore/Numerics/NormalGenerator.h"
+#include "BoxMullerKernel.h"
+#include <algorithm>
+#include <array>
+
+#if GREEKCORE_X86_64 && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace GreekCore {
+
+    namespace detail {
+
+        // Defined in NormalGeneratorAVX2.cpp / NormalGeneratorAVX512.cpp, compiled with the matching flags.
+        void boxMullerAVX2(const uint64_t* u1_bits, const uint64_t* u2_bits, double* cos_out, double* sin_out, size_t pairs);
+        void boxMullerAVX512(const uint64_t* u1_bits, const uint64_t* u2_bits, double* cos_out, double* sin_out, size_t pairs);
+        void boxMullerFloatAVX2(const uint32_t* u1_bits, const uint32_t* u2_bits, float* cos_out, float* sin_out, size_t pairs);
+        void boxMullerFloatAVX512(const uint32_t* u1_bits, const uint32_t* u2_bits, float* cos_out, float* sin_out, size_t pairs);
+
+        void boxMullerScalar(const uint64_t* u1_bits, const uint64_t* u2_bits, double* cos_out, double* sin_out, size_t pairs) {
+            boxMullerKernel<ScalarOps>(u1_bits, u2_bits, cos_out, sin_out, pairs);
+        }
+
+        void boxMullerFloatScalar(const uint32_t* u1_bits, const uint32_t* u2_bits, float* cos_out, float* sin_out, size_t pairs) {
+            boxMullerFloatKernel<ScalarFloatOps>(u1_bits, u2_bits, cos_out, sin_out, pairs);
+        }
+
+#if GREEKCORE_X86_64
+        void boxMullerSSE2(const uint64_t* u1_bits, const uint64_t* u2_bits, double* cos_out, double* sin_out, size_t pairs) {
+            boxMullerKernel<SSE2Ops>(u1_bits, u2_bits, cos_out, sin_out, pairs);
+        }
+
+        void boxMullerFloatSSE2(const uint32_t* u1_bits, const uint32_t* u2_bits, float* cos_out, float* sin_out, size_t pairs) {
+            boxMullerFloatKernel<SSE2FloatOps>(u1_bits, u2_bits, cos_out, sin_out, pairs);
+        }
+#endif
+    }
+
+    namespace {
+
+        SimdLevel detectSimdLevelUncached() {
+#if GREEKCORE_X86_64
+    #if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+            __cpuidex(info, 7, 0);
+            const bool avx2 = avx && (xcr0 & 0x6) == 0x6 && (info[1] & (1 << 5)) != 0;
+            const bool avx512 = avx2 && (xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)) != 0;
+    #else
+            __builtin_cpu_init();
+            const bool avx2 = __builtin_cpu_supports("avx2");
+            const bool avx512 = __builtin_cpu_supports("avx512f");
+    #endif
+    #if defined(GREEKCORE_HAS_AVX512_KERNEL)
+            if (avx512) return SimdLevel::AVX512;
+    #endif
+    #if defined(GREEKCORE_HAS_AVX2_KERNEL)
+            if (avx2) return SimdLevel::AVX2;
+    #endif
+            (void)avx2;
+            (void)avx512;
+            return SimdLevel::SSE2;
+#else
+            return SimdLevel::Scalar;
+#endif
+        }
+
+        // Normals produced per call of the kernel; both halves of each Box-Muller pair are kept.
+        constexpr size_t kBlockPairs = 256;
+    }
+
+    SimdLevel detectSimdLevel() {
+        static const SimdLevel level = detectSimdLevelUncached();
+        return level;
+    }
+
+    NormalBatchGenerator::NormalBatchGenerator(const Xoshiro256& rng, SimdLevel max_level)
+        : m_rng(rng), m_level(std::min(max_level, detectSimdLevel())), m_kernel(&detail::boxMullerScalar),
+          m_float_kernel(&detail::boxMullerFloatScalar) {
+        switch (m_level) {
+#if GREEKCORE_X86_64
+    #if defined(GREEKCORE_HAS_AVX512_KERNEL)
+            case SimdLevel::AVX512: m_kernel = &detail::boxMullerAVX512; m_float_kernel = &detail::boxMullerFloatAVX512; break;
+    #endif
+    #if defined(GREEKCORE_HAS_AVX2_KERNEL)
+            case SimdLevel::AVX2: m_kernel = &detail::boxMullerAVX2; m_float_kernel = &detail::boxMullerFloatAVX2; break;
+    #endif
+            case SimdLevel::SSE2: m_kernel = &detail::boxMullerSSE2; m_float_kernel = &detail::boxMullerFloatSSE2; break;
+#endif
+            default: m_level = SimdLevel::Scalar; break;
+        }
+    }
+
+    void NormalBatchGenerator::fill(std::span<double> out) {
+        std::array<uint64_t, 2 * kBlockPairs> bits;
+        std::array<double, 2 * kBlockPairs> tail;
+
+        while (!out.empty()) {
+            const size_t n = std::min(out.size(), 2 * kBlockPairs);
+            const size_t pairs = (n + 1) / 2;
+
+            for (size_t i = 0; i < 2 * pairs; ++i) bits[i] = m_rng();
+
+            if (n == 2 * pairs) {
+                m_kernel(bits.data(), bits.data() + pairs, out.data(), out.data() + pairs, pairs);
+            } else {
+                // Odd length: the last sine output is discarded.
+                m_kernel(bits.data(), bits.data() + pairs, tail.data(), tail.data() + pairs, pairs);
+                std::copy_n(tail.data(), n, out.data());
+            }
+            out = out.subspan(n);
+        }
+    }
+
+    void NormalBatchGenerator::fill(std::span<float> out) {
+        std::array<uint32_t, 2 * kBlockPairs> bits;
+        std::array<float, 2 * kBlockPairs> tail;
+
+        while (!out.empty()) {
+            const size_t n = std::min(out.size(), 2 * kBlockPairs);
+            const size_t pairs = (n + 1) / 2;
+
+            // Each 64-bit draw supplies two 32-bit words (low half first).
+            for (size_t i = 0; i < pairs; ++i) {
+                const uint64_t x = m_rng();
+                bits[2 * i] = static_cast<uint32_t>(x);
+                bits[2 * i + 1] = static_cast<uint32_t>(x >> 32);
+            }
+
+            if (n == 2 * pairs) {
+                m_float_kernel(bits.data(), bits.data() + pairs, out.data(), out.data() + pairs, pairs);
+            } else {
+                m_float_kernel(bits.data(), bits.data() + pairs, tail.data(), tail.data() + pairs, pairs);
+                std::copy_n(tail.data(), n, out.data());
+            }
+            out = out.subspan(n);
+        }
+    }
+
+}
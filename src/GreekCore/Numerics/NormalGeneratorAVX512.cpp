@@ -0,0 +1,13 @@
+// Compiled with AVX-512F enabled (see CMakeLists.txt); only reached after runtime CPU detection.
+#include "BoxMullerKernel.h"
+
+namespace GreekCore::detail {
+
+    void boxMullerAVX512(const uint64_t* u1_bits, const uint64_t* u2_bits, double* cos_out, double* sin_out, size_t pairs) {
+        boxMullerKernel<AVX512Ops>(u1_bits, u2_bits, cos_out, sin_out, pairs);
+    }
+
+    void boxMullerFloatAVX512(const uint32_t* u1_bits, const uint32_t* u2_bits, float* cos_out, float* sin_out, size_t pairs) {
+        boxMullerFloatKernel<AVX512FloatOps>(u1_bits, u2_bits, cos_out, sin_out, pairs);
+    }
+}
@@ -1,7 +1,67 @@
 #include "GreekCore/Numerics/RNG.h"
+#include <vector>
+#include <cstddef>
 
 namespace GreekCore {
 
+    namespace {
+        using State = std::array<uint64_t, 4>;
+
+        // Advances a state by the jump polynomial 'poly' (Blackman & Vigna's reference scheme).
+        void applyJumpPolynomial(Xoshiro256& rng, const State& poly) {
+            State t{0, 0, 0, 0};
+            for (uint64_t word : poly) {
+                for (int b = 0; b < 64; ++b) {
+                    if (word & (uint64_t{1} << b)) {
+                        for (int i = 0; i < 4; ++i) t[i] ^= rng.s[i];
+                    }
+                    rng();
+                }
+            }
+            rng.s = t;
+        }
+
+        /**
+         * A 256x256 matrix over GF(2), stored by columns: column i is the image of the
+         * state with only bit i set. Applying it to a state XORs the columns of its set bits.
+         */
+        struct JumpMatrix {
+            std::array<State, 256> columns;
+
+            State apply(const State& x) const {
+                State out{0, 0, 0, 0};
+                for (int w = 0; w < 4; ++w) {
+                    for (uint64_t bits = x[w]; bits != 0; bits &= bits - 1) {
+                        const State& col = columns[w * 64 + std::countr_zero(bits)];
+                        for (int i = 0; i < 4; ++i) out[i] ^= col[i];
+                    }
+                }
+                return out;
+            }
+        };
+
+        // powers[i] = J^(2^i) where J is the 2^128-step jump.
+        const std::vector<JumpMatrix>& jumpPowers() {
+            static const std::vector<JumpMatrix> powers = [] {
+                std::vector<JumpMatrix> p(64);
+                for (int i = 0; i < 256; ++i) {
+                    Xoshiro256 unit(0);
+                    unit.s = {0, 0, 0, 0};
+                    unit.s[i / 64] = uint64_t{1} << (i % 64);
+                    unit.jump();
+                    p[0].columns[i] = unit.s;
+                }
+                for (std::size_t k = 1; k < p.size(); ++k) {
+                    for (int i = 0; i < 256; ++i) {
+                        p[k].columns[i] = p[k - 1].apply(p[k - 1].columns[i]);
+                    }
+                }
+                return p;
+            }();
+            return powers;
+        }
+    }
+
     Xoshiro256::Xoshiro256(uint64_t seed) {
         // SplitMix64 initialization
         for (int i = 0; i < 4; ++i) {
@@ -26,4 +86,29 @@ namespace GreekCore {
 
         return result;
     }
+
+    void Xoshiro256::jump() {
+        static constexpr State JUMP = {
+            0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c
+        };
+        applyJumpPolynomial(*this, JUMP);
+    }
+
+    void Xoshiro256::long_jump() {
+        static constexpr State LONG_JUMP = {
+            0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635
+        };
+        applyJumpPolynomial(*this, LONG_JUMP);
+    }
+
+    Xoshiro256 StreamFactory::stream(uint64_t k) const {
+        Xoshiro256 result = m_root;
+        if (k == 0) return result;
+
+        const auto& powers = jumpPowers();
+        for (int i = 0; k != 0; ++i, k >>= 1) {
+            if (k & 1) result.s = powers[i].apply(result.s);
+        }
+        return result;
+    }
 }
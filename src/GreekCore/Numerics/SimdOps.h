@@ -0,0 +1,307 @@
+#ifndef GREEKCORE_SIMDOPS_H
+#define GREEKCORE_SIMDOPS_H
+
+/**
+ * @file SimdOps.h
+ * @brief Private "ops" interface the vectorized kernels are written against.
+ *
+ * Each struct wraps one instruction set: load/store, bit casts, integer and floating point
+ * arithmetic and select. An ops struct is only defined when the including translation unit
+ * is compiled for its instruction set (AVX2Ops needs -mavx2, ...), see CMakeLists.txt.
+ * Everything lives in an anonymous namespace so that instantiations compiled with wider
+ * instruction sets can never be merged by the linker into baseline code.
+ *
+ * The *FloatOps structs are the single precision counterparts (twice the lanes, 32-bit
+ * integer lanes, `loadf` / `asFloat` instead of `loadd` / `asDouble`).
+ */
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <bit>
+#include "GreekCore/Utils/CompilerMacros.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define GREEKCORE_X86_64 1
+    #include <emmintrin.h>
+#endif
+#if defined(__AVX2__) || defined(__AVX512F__)
+    #include <immintrin.h>
+#endif
+
+namespace GreekCore::detail {
+namespace {
+
+    /// One-lane reference implementation of the ops interface.
+    struct ScalarOps {
+        using D = double;
+        using I = uint64_t;
+        using M = bool;
+        static constexpr size_t width = 1;
+
+        static FORCE_INLINE I load(const uint64_t* p) { return *p; }
+        static FORCE_INLINE D loadd(const double* p) { return *p; }
+        static FORCE_INLINE void store(double* p, D x) { *p = x; }
+        static FORCE_INLINE D set1(double x) { return x; }
+        static FORCE_INLINE I set1i(uint64_t x) { return x; }
+        static FORCE_INLINE D asDouble(I x) { return std::bit_cast<double>(x); }
+        static FORCE_INLINE I asBits(D x) { return std::bit_cast<uint64_t>(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return a & b; }
+        static FORCE_INLINE I andnot(I a, I b) { return ~a & b; }
+        static FORCE_INLINE I or_(I a, I b) { return a | b; }
+        static FORCE_INLINE I xor_(I a, I b) { return a ^ b; }
+        static FORCE_INLINE I addi(I a, I b) { return a + b; }
+        static FORCE_INLINE I subi(I a, I b) { return a - b; }
+        template<int N> static FORCE_INLINE I srl(I a) { return a >> N; }
+        template<int N> static FORCE_INLINE I sll(I a) { return a << N; }
+
+        static FORCE_INLINE D add(D a, D b) { return a + b; }
+        static FORCE_INLINE D sub(D a, D b) { return a - b; }
+        static FORCE_INLINE D mul(D a, D b) { return a * b; }
+        static FORCE_INLINE D div(D a, D b) { return a / b; }
+        static FORCE_INLINE D sqrt(D a) { return std::sqrt(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return a > b; }
+        static FORCE_INLINE D select(M m, D a, D b) { return m ? a : b; }
+    };
+
+    /// One-lane reference implementation of the single precision ops interface.
+    struct ScalarFloatOps {
+        using D = float;
+        using I = uint32_t;
+        using M = bool;
+        static constexpr size_t width = 1;
+
+        static FORCE_INLINE I load(const uint32_t* p) { return *p; }
+        static FORCE_INLINE D loadf(const float* p) { return *p; }
+        static FORCE_INLINE void store(float* p, D x) { *p = x; }
+        static FORCE_INLINE D set1(float x) { return x; }
+        static FORCE_INLINE I set1i(uint32_t x) { return x; }
+        static FORCE_INLINE D asFloat(I x) { return std::bit_cast<float>(x); }
+        static FORCE_INLINE I asBits(D x) { return std::bit_cast<uint32_t>(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return a & b; }
+        static FORCE_INLINE I andnot(I a, I b) { return ~a & b; }
+        static FORCE_INLINE I or_(I a, I b) { return a | b; }
+        static FORCE_INLINE I xor_(I a, I b) { return a ^ b; }
+        static FORCE_INLINE I addi(I a, I b) { return a + b; }
+        static FORCE_INLINE I subi(I a, I b) { return a - b; }
+        template<int N> static FORCE_INLINE I srl(I a) { return a >> N; }
+        template<int N> static FORCE_INLINE I sll(I a) { return a << N; }
+
+        static FORCE_INLINE D add(D a, D b) { return a + b; }
+        static FORCE_INLINE D sub(D a, D b) { return a - b; }
+        static FORCE_INLINE D mul(D a, D b) { return a * b; }
+        static FORCE_INLINE D div(D a, D b) { return a / b; }
+        static FORCE_INLINE D sqrt(D a) { return std::sqrt(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return a > b; }
+        static FORCE_INLINE D select(M m, D a, D b) { return m ? a : b; }
+    };
+
+#if GREEKCORE_X86_64
+    // SSE2 is part of the x86-64 baseline, so it is available in every translation unit.
+    struct SSE2Ops {
+        using D = __m128d;
+        using I = __m128i;
+        using M = __m128d;
+        static constexpr size_t width = 2;
+
+        static FORCE_INLINE I load(const uint64_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        static FORCE_INLINE D loadd(const double* p) { return _mm_loadu_pd(p); }
+        static FORCE_INLINE void store(double* p, D x) { _mm_storeu_pd(p, x); }
+        static FORCE_INLINE D set1(double x) { return _mm_set1_pd(x); }
+        static FORCE_INLINE I set1i(uint64_t x) { return _mm_set1_epi64x(static_cast<long long>(x)); }
+        static FORCE_INLINE D asDouble(I x) { return _mm_castsi128_pd(x); }
+        static FORCE_INLINE I asBits(D x) { return _mm_castpd_si128(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return _mm_and_si128(a, b); }
+        static FORCE_INLINE I andnot(I a, I b) { return _mm_andnot_si128(a, b); }
+        static FORCE_INLINE I or_(I a, I b) { return _mm_or_si128(a, b); }
+        static FORCE_INLINE I xor_(I a, I b) { return _mm_xor_si128(a, b); }
+        static FORCE_INLINE I addi(I a, I b) { return _mm_add_epi64(a, b); }
+        static FORCE_INLINE I subi(I a, I b) { return _mm_sub_epi64(a, b); }
+        template<int N> static FORCE_INLINE I srl(I a) { return _mm_srli_epi64(a, N); }
+        template<int N> static FORCE_INLINE I sll(I a) { return _mm_slli_epi64(a, N); }
+
+        static FORCE_INLINE D add(D a, D b) { return _mm_add_pd(a, b); }
+        static FORCE_INLINE D sub(D a, D b) { return _mm_sub_pd(a, b); }
+        static FORCE_INLINE D mul(D a, D b) { return _mm_mul_pd(a, b); }
+        static FORCE_INLINE D div(D a, D b) { return _mm_div_pd(a, b); }
+        static FORCE_INLINE D sqrt(D a) { return _mm_sqrt_pd(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return _mm_cmpgt_pd(a, b); }
+        static FORCE_INLINE D select(M m, D a, D b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b)); }
+    };
+    struct SSE2FloatOps {
+        using D = __m128;
+        using I = __m128i;
+        using M = __m128;
+        static constexpr size_t width = 4;
+
+        static FORCE_INLINE I load(const uint32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        static FORCE_INLINE D loadf(const float* p) { return _mm_loadu_ps(p); }
+        static FORCE_INLINE void store(float* p, D x) { _mm_storeu_ps(p, x); }
+        static FORCE_INLINE D set1(float x) { return _mm_set1_ps(x); }
+        static FORCE_INLINE I set1i(uint32_t x) { return _mm_set1_epi32(static_cast<int>(x)); }
+        static FORCE_INLINE D asFloat(I x) { return _mm_castsi128_ps(x); }
+        static FORCE_INLINE I asBits(D x) { return _mm_castps_si128(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return _mm_and_si128(a, b); }
+        static FORCE_INLINE I andnot(I a, I b) { return _mm_andnot_si128(a, b); }
+        static FORCE_INLINE I or_(I a, I b) { return _mm_or_si128(a, b); }
+        static FORCE_INLINE I xor_(I a, I b) { return _mm_xor_si128(a, b); }
+        static FORCE_INLINE I addi(I a, I b) { return _mm_add_epi32(a, b); }
+        static FORCE_INLINE I subi(I a, I b) { return _mm_sub_epi32(a, b); }
+        template<int N> static FORCE_INLINE I srl(I a) { return _mm_srli_epi32(a, N); }
+        template<int N> static FORCE_INLINE I sll(I a) { return _mm_slli_epi32(a, N); }
+
+        static FORCE_INLINE D add(D a, D b) { return _mm_add_ps(a, b); }
+        static FORCE_INLINE D sub(D a, D b) { return _mm_sub_ps(a, b); }
+        static FORCE_INLINE D mul(D a, D b) { return _mm_mul_ps(a, b); }
+        static FORCE_INLINE D div(D a, D b) { return _mm_div_ps(a, b); }
+        static FORCE_INLINE D sqrt(D a) { return _mm_sqrt_ps(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return _mm_cmpgt_ps(a, b); }
+        static FORCE_INLINE D select(M m, D a, D b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    };
+#endif
+
+#if defined(__AVX2__)
+    struct AVX2Ops {
+        using D = __m256d;
+        using I = __m256i;
+        using M = __m256d;
+        static constexpr size_t width = 4;
+
+        static FORCE_INLINE I load(const uint64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static FORCE_INLINE D loadd(const double* p) { return _mm256_loadu_pd(p); }
+        static FORCE_INLINE void store(double* p, D x) { _mm256_storeu_pd(p, x); }
+        static FORCE_INLINE D set1(double x) { return _mm256_set1_pd(x); }
+        static FORCE_INLINE I set1i(uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+        static FORCE_INLINE D asDouble(I x) { return _mm256_castsi256_pd(x); }
+        static FORCE_INLINE I asBits(D x) { return _mm256_castpd_si256(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return _mm256_and_si256(a, b); }
+        static FORCE_INLINE I andnot(I a, I b) { return _mm256_andnot_si256(a, b); }
+        static FORCE_INLINE I or_(I a, I b) { return _mm256_or_si256(a, b); }
+        static FORCE_INLINE I xor_(I a, I b) { return _mm256_xor_si256(a, b); }
+        static FORCE_INLINE I addi(I a, I b) { return _mm256_add_epi64(a, b); }
+        static FORCE_INLINE I subi(I a, I b) { return _mm256_sub_epi64(a, b); }
+        template<int N> static FORCE_INLINE I srl(I a) { return _mm256_srli_epi64(a, N); }
+        template<int N> static FORCE_INLINE I sll(I a) { return _mm256_slli_epi64(a, N); }
+
+        static FORCE_INLINE D add(D a, D b) { return _mm256_add_pd(a, b); }
+        static FORCE_INLINE D sub(D a, D b) { return _mm256_sub_pd(a, b); }
+        static FORCE_INLINE D mul(D a, D b) { return _mm256_mul_pd(a, b); }
+        static FORCE_INLINE D div(D a, D b) { return _mm256_div_pd(a, b); }
+        static FORCE_INLINE D sqrt(D a) { return _mm256_sqrt_pd(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+        static FORCE_INLINE D select(M m, D a, D b) { return _mm256_blendv_pd(b, a, m); }
+    };
+    struct AVX2FloatOps {
+        using D = __m256;
+        using I = __m256i;
+        using M = __m256;
+        static constexpr size_t width = 8;
+
+        static FORCE_INLINE I load(const uint32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        static FORCE_INLINE D loadf(const float* p) { return _mm256_loadu_ps(p); }
+        static FORCE_INLINE void store(float* p, D x) { _mm256_storeu_ps(p, x); }
+        static FORCE_INLINE D set1(float x) { return _mm256_set1_ps(x); }
+        static FORCE_INLINE I set1i(uint32_t x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+        static FORCE_INLINE D asFloat(I x) { return _mm256_castsi256_ps(x); }
+        static FORCE_INLINE I asBits(D x) { return _mm256_castps_si256(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return _mm256_and_si256(a, b); }
+        static FORCE_INLINE I andnot(I a, I b) { return _mm256_andnot_si256(a, b); }
+        static FORCE_INLINE I or_(I a, I b) { return _mm256_or_si256(a, b); }
+        static FORCE_INLINE I xor_(I a, I b) { return _mm256_xor_si256(a, b); }
+        static FORCE_INLINE I addi(I a, I b) { return _mm256_add_epi32(a, b); }
+        static FORCE_INLINE I subi(I a, I b) { return _mm256_sub_epi32(a, b); }
+        template<int N> static FORCE_INLINE I srl(I a) { return _mm256_srli_epi32(a, N); }
+        template<int N> static FORCE_INLINE I sll(I a) { return _mm256_slli_epi32(a, N); }
+
+        static FORCE_INLINE D add(D a, D b) { return _mm256_add_ps(a, b); }
+        static FORCE_INLINE D sub(D a, D b) { return _mm256_sub_ps(a, b); }
+        static FORCE_INLINE D mul(D a, D b) { return _mm256_mul_ps(a, b); }
+        static FORCE_INLINE D div(D a, D b) { return _mm256_div_ps(a, b); }
+        static FORCE_INLINE D sqrt(D a) { return _mm256_sqrt_ps(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+        static FORCE_INLINE D select(M m, D a, D b) { return _mm256_blendv_ps(b, a, m); }
+    };
+#endif
+
+#if defined(__AVX512F__)
+    struct AVX512Ops {
+        using D = __m512d;
+        using I = __m512i;
+        using M = __mmask8;
+        static constexpr size_t width = 8;
+
+        static FORCE_INLINE I load(const uint64_t* p) { return _mm512_loadu_si512(p); }
+        static FORCE_INLINE D loadd(const double* p) { return _mm512_loadu_pd(p); }
+        static FORCE_INLINE void store(double* p, D x) { _mm512_storeu_pd(p, x); }
+        static FORCE_INLINE D set1(double x) { return _mm512_set1_pd(x); }
+        static FORCE_INLINE I set1i(uint64_t x) { return _mm512_set1_epi64(static_cast<long long>(x)); }
+        static FORCE_INLINE D asDouble(I x) { return _mm512_castsi512_pd(x); }
+        static FORCE_INLINE I asBits(D x) { return _mm512_castpd_si512(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return _mm512_and_si512(a, b); }
+        static FORCE_INLINE I andnot(I a, I b) { return _mm512_andnot_si512(a, b); }
+        static FORCE_INLINE I or_(I a, I b) { return _mm512_or_si512(a, b); }
+        static FORCE_INLINE I xor_(I a, I b) { return _mm512_xor_si512(a, b); }
+        static FORCE_INLINE I addi(I a, I b) { return _mm512_add_epi64(a, b); }
+        static FORCE_INLINE I subi(I a, I b) { return _mm512_sub_epi64(a, b); }
+        template<int N> static FORCE_INLINE I srl(I a) { return _mm512_srli_epi64(a, N); }
+        template<int N> static FORCE_INLINE I sll(I a) { return _mm512_slli_epi64(a, N); }
+
+        static FORCE_INLINE D add(D a, D b) { return _mm512_add_pd(a, b); }
+        static FORCE_INLINE D sub(D a, D b) { return _mm512_sub_pd(a, b); }
+        static FORCE_INLINE D mul(D a, D b) { return _mm512_mul_pd(a, b); }
+        static FORCE_INLINE D div(D a, D b) { return _mm512_div_pd(a, b); }
+        static FORCE_INLINE D sqrt(D a) { return _mm512_sqrt_pd(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+        static FORCE_INLINE D select(M m, D a, D b) { return _mm512_mask_blend_pd(m, b, a); }
+    };
+    struct AVX512FloatOps {
+        using D = __m512;
+        using I = __m512i;
+        using M = __mmask16;
+        static constexpr size_t width = 16;
+
+        static FORCE_INLINE I load(const uint32_t* p) { return _mm512_loadu_si512(p); }
+        static FORCE_INLINE D loadf(const float* p) { return _mm512_loadu_ps(p); }
+        static FORCE_INLINE void store(float* p, D x) { _mm512_storeu_ps(p, x); }
+        static FORCE_INLINE D set1(float x) { return _mm512_set1_ps(x); }
+        static FORCE_INLINE I set1i(uint32_t x) { return _mm512_set1_epi32(static_cast<int>(x)); }
+        static FORCE_INLINE D asFloat(I x) { return _mm512_castsi512_ps(x); }
+        static FORCE_INLINE I asBits(D x) { return _mm512_castps_si512(x); }
+
+        static FORCE_INLINE I and_(I a, I b) { return _mm512_and_si512(a, b); }
+        static FORCE_INLINE I andnot(I a, I b) { return _mm512_andnot_si512(a, b); }
+        static FORCE_INLINE I or_(I a, I b) { return _mm512_or_si512(a, b); }
+        static FORCE_INLINE I xor_(I a, I b) { return _mm512_xor_si512(a, b); }
+        static FORCE_INLINE I addi(I a, I b) { return _mm512_add_epi32(a, b); }
+        static FORCE_INLINE I subi(I a, I b) { return _mm512_sub_epi32(a, b); }
+        template<int N> static FORCE_INLINE I srl(I a) { return _mm512_srli_epi32(a, N); }
+        template<int N> static FORCE_INLINE I sll(I a) { return _mm512_slli_epi32(a, N); }
+
+        static FORCE_INLINE D add(D a, D b) { return _mm512_add_ps(a, b); }
+        static FORCE_INLINE D sub(D a, D b) { return _mm512_sub_ps(a, b); }
+        static FORCE_INLINE D mul(D a, D b) { return _mm512_mul_ps(a, b); }
+        static FORCE_INLINE D div(D a, D b) { return _mm512_div_ps(a, b); }
+        static FORCE_INLINE D sqrt(D a) { return _mm512_sqrt_ps(a); }
+
+        static FORCE_INLINE M gt(D a, D b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+        static FORCE_INLINE D select(M m, D a, D b) { return _mm512_mask_blend_ps(m, b, a); }
+    };
+#endif
+
+}
+}
+#endif // GREEKCORE_SIMDOPS_H
@@ -0,0 +1,111 @@
+#include "GreekCore/Numerics/Sobol.h"
+#include "GreekCore/Numerics/RNG.h"
+#include "SobolDirections.h"
+#include <bit>
+#include <stdexcept>
+#include <algorithm>
+
+namespace GreekCore {
+
+    namespace {
+        constexpr int kBits = 32;
+
+        uint32_t reverseBits(uint32_t x) {
+            x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+            x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+            x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+            x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+            return (x >> 16) | (x << 16);
+        }
+
+        // Laine-Karras style permutation: each output bit only depends on the input bits below it,
+        // which (applied to the reversed value) is exactly a nested uniform scramble.
+        uint32_t laineKarrasPermutation(uint32_t x, uint32_t seed) {
+            x += seed;
+            x ^= x * 0x6c50b47cu;
+            x ^= x * 0xb82f1e52u;
+            x ^= x * 0xc7afe638u;
+            x ^= x * 0x8d22f6e6u;
+            return x;
+        }
+
+        uint32_t owenScramble(uint32_t x, uint32_t seed) {
+            return reverseBits(laineKarrasPermutation(reverseBits(x), seed));
+        }
+    }
+
+    SobolSequence::SobolSequence(size_t dimension, SobolScrambling scrambling, uint64_t seed)
+        : m_dimension(dimension), m_scrambling(scrambling), m_index(0),
+          m_directions(kBits * dimension), m_state(dimension), m_scramble(dimension, 0) {
+
+        if (dimension == 0 || dimension > kMaxDimension) {
+            throw std::invalid_argument("Sobol dimension must be between 1 and 1024");
+        }
+
+        // Dimension 1: van der Corput in base 2
+        for (int k = 0; k < kBits; ++k) {
+            m_directions[k * dimension] = uint32_t{1} << (kBits - 1 - k);
+        }
+
+        for (size_t d = 1; d < dimension; ++d) {
+            const uint32_t poly = detail::kSobolPolynomials[d - 1];
+            const int degree = std::bit_width(poly) - 1;
+            const uint32_t a = (poly >> 1) & ((uint32_t{1} << (degree - 1)) - 1);
+            auto v = [&](int k) -> uint32_t& { return m_directions[k * dimension + d]; };
+
+            for (int k = 0; k < degree && k < kBits; ++k) {
+                v(k) = uint32_t{detail::kSobolInitialDirections[d - 1][k]} << (kBits - 1 - k);
+            }
+            for (int k = degree; k < kBits; ++k) {
+                uint32_t value = v(k - degree) ^ (v(k - degree) >> degree);
+                for (int i = 1; i < degree; ++i) {
+                    if ((a >> (degree - 1 - i)) & 1u) value ^= v(k - i);
+                }
+                v(k) = value;
+            }
+        }
+
+        if (m_scrambling != SobolScrambling::None) {
+            Xoshiro256 rng(seed);
+            for (auto& s : m_scramble) s = static_cast<uint32_t>(rng() >> 32);
+        }
+
+        skipTo(0);
+    }
+
+    void SobolSequence::skipTo(uint64_t index) {
+        m_index = index + firstIndex();
+        const uint64_t gray = m_index ^ (m_index >> 1);
+
+        std::fill(m_state.begin(), m_state.end(), 0u);
+        for (int k = 0; k < kBits; ++k) {
+            if (gray & (uint64_t{1} << k)) {
+                for (size_t d = 0; d < m_dimension; ++d) m_state[d] ^= m_directions[k * m_dimension + d];
+            }
+        }
+    }
+
+    void SobolSequence::next(std::span<double> out) {
+        if (m_index >> kBits) [[unlikely]] {
+            throw std::out_of_range("Sobol sequence exhausted (2^32 points)");
+        }
+
+        for (size_t d = 0; d < m_dimension; ++d) {
+            uint32_t x = m_state[d];
+            switch (m_scrambling) {
+                case SobolScrambling::DigitalShift: x ^= m_scramble[d]; break;
+                case SobolScrambling::Owen: x = owenScramble(x, m_scramble[d]); break;
+                default: break;
+            }
+            out[d] = (static_cast<double>(x) + 0.5) * 0x1.0p-32;
+        }
+
+        // Gray-code update: x_{n+1} = x_n ^ v[ctz(n + 1)]
+        ++m_index;
+        const int c = std::countr_zero(m_index);
+        if (c < kBits) {
+            for (size_t d = 0; d < m_dimension; ++d) m_state[d] ^= m_directions[c * m_dimension + d];
+        }
+    }
+
+}
@@ -0,0 +1,18 @@
+#ifndef GREEKCORE_SOBOLDIRECTIONS_H
+#define GREEKCORE_SOBOLDIRECTIONS_H
+
+#include <cstdint>
+#include <cstddef>
+
+namespace GreekCore::detail {
+
+    /// Number of tabulated dimensions (dimension 1 is implicit, so 1 + kSobolTableDimensions are available).
+    inline constexpr size_t kSobolTableDimensions = 1023;
+    /// Largest polynomial degree in the table.
+    inline constexpr size_t kSobolMaxDegree = 13;
+
+    extern const uint16_t kSobolPolynomials[kSobolTableDimensions];
+    extern const uint16_t kSobolInitialDirections[kSobolTableDimensions][kSobolMaxDegree];
+
+}
+#endif // GREEKCORE_SOBOLDIRECTIONS_H
@@ -3,13 +3,18 @@
 namespace GreekCore {
 
     std::vector<std::vector<double>> StatisticsMean::getResultsSoFar() const {
-        std::vector<std::vector<double>> results(1);
-        results[0].resize(2); // [Mean, StdErr]
+        GathererSnapshot snap;
+        snapshot(snap);
+        return {{snap.mean, snap.std_error}}; // [Mean, StdErr]
+    }
 
-        if (m_pathsDone == 0) return results;
+    void StatisticsMean::snapshot(GathererSnapshot& out) const {
+        out = GathererSnapshot{};
+        if (m_pathsDone == 0) return;
 
         double mean = m_runningSum / m_pathsDone;
-        results[0][0] = mean;
+        out.mean = mean;
+        out.paths = m_pathsDone;
 
         double variance = (m_runningSumSq - mean * m_runningSum);
         if (m_pathsDone > 1) {
@@ -20,10 +25,7 @@ namespace GreekCore {
 
         if (variance < 0.0) variance = 0.0;
         
-        double stdErr = std::sqrt(variance / m_pathsDone);
-        results[0][1] = stdErr;
-
-        return results;
+        out.std_error = std::sqrt(variance / m_pathsDone);
     }
 
 }
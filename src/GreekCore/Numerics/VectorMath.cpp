@@ -0,0 +1,92 @@
+#include "GreekCore/Numerics/VectorMath.h"
+#include "ExpKernel.h"
+#include "LinearKernel.h"
+#include <algorithm>
+#include <array>
+
+namespace GreekCore {
+
+    namespace detail {
+
+        // Defined in VectorMathAVX2.cpp / VectorMathAVX512.cpp, compiled with the matching flags.
+        void expBatchAVX2(const double* x, double* out, size_t n);
+        void expBatchAVX512(const double* x, double* out, size_t n);
+        void lognormalStepAVX2(double* spot, const double* z, size_t n, double drift, double diffusion);
+        void lognormalStepAVX512(double* spot, const double* z, size_t n, double drift, double diffusion);
+        void expBatchFloatAVX2(const float* x, float* out, size_t n);
+        void expBatchFloatAVX512(const float* x, float* out, size_t n);
+        void lognormalStepFloatAVX2(float* spot, const float* z, size_t n, float drift, float diffusion);
+        void lognormalStepFloatAVX512(float* spot, const float* z, size_t n, float drift, float diffusion);
+        void lowerTriangularAVX2(const double* lower, size_t n, const double* z, double* x, size_t block);
+        void lowerTriangularAVX512(const double* lower, size_t n, const double* z, double* x, size_t block);
+    }
+
+    namespace {
+
+        using ExpKernel = void (*)(const double* x, double* out, size_t n);
+        using StepKernel = void (*)(double* spot, const double* z, size_t n, double drift, double diffusion);
+        using ExpFloatKernel = void (*)(const float* x, float* out, size_t n);
+        using StepFloatKernel = void (*)(float* spot, const float* z, size_t n, float drift, float diffusion);
+        using LowerTriangularKernel = void (*)(const double* lower, size_t n, const double* z, double* x, size_t block);
+
+        struct Kernels {
+            ExpKernel exp;
+            StepKernel step;
+            LowerTriangularKernel lower_triangular;
+            ExpFloatKernel exp_float;
+            StepFloatKernel step_float;
+        };
+
+        Kernels kernelsFor(SimdLevel level) {
+            switch (level) {
+#if GREEKCORE_X86_64
+    #if defined(GREEKCORE_HAS_AVX512_KERNEL)
+                case SimdLevel::AVX512: return {&detail::expBatchAVX512, &detail::lognormalStepAVX512, &detail::lowerTriangularAVX512,
+                                              &detail::expBatchFloatAVX512, &detail::lognormalStepFloatAVX512};
+    #endif
+    #if defined(GREEKCORE_HAS_AVX2_KERNEL)
+                case SimdLevel::AVX2: return {&detail::expBatchAVX2, &detail::lognormalStepAVX2, &detail::lowerTriangularAVX2,
+                                            &detail::expBatchFloatAVX2, &detail::lognormalStepFloatAVX2};
+    #endif
+                case SimdLevel::SSE2: return {&detail::expBatchKernel<detail::SSE2Ops>, &detail::lognormalStepKernel<detail::SSE2Ops>,
+                                          &detail::lowerTriangularKernel<detail::SSE2Ops>,
+                                          &detail::expBatchFloatKernel<detail::SSE2FloatOps>,
+                                          &detail::lognormalStepFloatKernel<detail::SSE2FloatOps>};
+#endif
+                default: return {&detail::expBatchKernel<detail::ScalarOps>, &detail::lognormalStepKernel<detail::ScalarOps>,
+                                 &detail::lowerTriangularKernel<detail::ScalarOps>,
+                                 &detail::expBatchFloatKernel<detail::ScalarFloatOps>,
+                                 &detail::lognormalStepFloatKernel<detail::ScalarFloatOps>};
+            }
+        }
+
+        const Kernels& kernels(SimdLevel max_level) {
+            // detectSimdLevel() only reports levels whose kernels are built.
+            static const std::array<Kernels, 4> table = {kernelsFor(SimdLevel::Scalar), kernelsFor(SimdLevel::SSE2),
+                                                         kernelsFor(SimdLevel::AVX2), kernelsFor(SimdLevel::AVX512)};
+            return table[static_cast<size_t>(std::min(max_level, detectSimdLevel()))];
+        }
+    }
+
+    void expBatch(std::span<const double> x, std::span<double> out, SimdLevel max_level) {
+        kernels(max_level).exp(x.data(), out.data(), std::min(x.size(), out.size()));
+    }
+
+    void lognormalStep(std::span<double> spot, std::span<const double> z, double drift, double diffusion, SimdLevel max_level) {
+        kernels(max_level).step(spot.data(), z.data(), std::min(spot.size(), z.size()), drift, diffusion);
+    }
+
+    void expBatch(std::span<const float> x, std::span<float> out, SimdLevel max_level) {
+        kernels(max_level).exp_float(x.data(), out.data(), std::min(x.size(), out.size()));
+    }
+
+    void lognormalStep(std::span<float> spot, std::span<const float> z, float drift, float diffusion, SimdLevel max_level) {
+        kernels(max_level).step_float(spot.data(), z.data(), std::min(spot.size(), z.size()), drift, diffusion);
+    }
+
+    void lowerTriangularMultiply(std::span<const double> lower, size_t n, std::span<const double> z, std::span<double> x,
+                                 size_t block, SimdLevel max_level) {
+        kernels(max_level).lower_triangular(lower.data(), n, z.data(), x.data(), block);
+    }
+
+}
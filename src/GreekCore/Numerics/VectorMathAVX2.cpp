@@ -0,0 +1,26 @@
+// Compiled with AVX2 enabled (see CMakeLists.txt); only reached after runtime CPU detection.
+#include "ExpKernel.h"
+#include "LinearKernel.h"
+
+namespace GreekCore::detail {
+
+    void expBatchAVX2(const double* x, double* out, size_t n) {
+        expBatchKernel<AVX2Ops>(x, out, n);
+    }
+
+    void lognormalStepAVX2(double* spot, const double* z, size_t n, double drift, double diffusion) {
+        lognormalStepKernel<AVX2Ops>(spot, z, n, drift, diffusion);
+    }
+
+    void expBatchFloatAVX2(const float* x, float* out, size_t n) {
+        expBatchFloatKernel<AVX2FloatOps>(x, out, n);
+    }
+
+    void lognormalStepFloatAVX2(float* spot, const float* z, size_t n, float drift, float diffusion) {
+        lognormalStepFloatKernel<AVX2FloatOps>(spot, z, n, drift, diffusion);
+    }
+
+    void lowerTriangularAVX2(const double* lower, size_t n, const double* z, double* x, size_t block) {
+        lowerTriangularKernel<AVX2Ops>(lower, n, z, x, block);
+    }
+}
@@ -0,0 +1,26 @@
+// Compiled with AVX-512F enabled (see CMakeLists.txt); only reached after runtime CPU detection.
+#include "ExpKernel.h"
+#include "LinearKernel.h"
+
+namespace GreekCore::detail {
+
+    void expBatchAVX512(const double* x, double* out, size_t n) {
+        expBatchKernel<AVX512Ops>(x, out, n);
+    }
+
+    void lognormalStepAVX512(double* spot, const double* z, size_t n, double drift, double diffusion) {
+        lognormalStepKernel<AVX512Ops>(spot, z, n, drift, diffusion);
+    }
+
+    void expBatchFloatAVX512(const float* x, float* out, size_t n) {
+        expBatchFloatKernel<AVX512FloatOps>(x, out, n);
+    }
+
+    void lognormalStepFloatAVX512(float* spot, const float* z, size_t n, float drift, float diffusion) {
+        lognormalStepFloatKernel<AVX512FloatOps>(spot, z, n, drift, diffusion);
+    }
+
+    void lowerTriangularAVX512(const double* lower, size_t n, const double* z, double* x, size_t block) {
+        lowerTriangularKernel<AVX512Ops>(lower, n, z, x, block);
+    }
+}
@@ -0,0 +1,80 @@
+#include "GreekCore/Pricing/Barrier.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreekCore {
+
+    double bridgeSurvivalProbability(double barrier, bool upper, double s1, double s2, double variance) {
+        const double a = std::log(barrier / s1), b = std::log(barrier / s2);
+        const bool inside = upper ? (a > 0.0 && b > 0.0) : (a < 0.0 && b < 0.0);
+        if (!inside) return 0.0;
+        if (variance <= 0.0) return 1.0;
+        return -std::expm1(-2.0 * a * b / variance);
+    }
+
+    double bridgeSurvivalProbability(double lower, double upper, double s1, double s2, double variance) {
+        const double x = std::log(s1 / lower), y = std::log(s2 / lower), w = std::log(upper / lower);
+        if (x <= 0.0 || y <= 0.0 || x >= w || y >= w) return 0.0;
+        if (variance <= 0.0) return 1.0;
+
+        // P = sum_k exp(-2 k w (k w + y - x) / v) - exp(-2 (k w + x)(k w + y) / v), k in Z.
+        double p = -std::expm1(-2.0 * x * y / variance);
+        for (int k = 1; k < 64; ++k) {
+            const double kw = k * w;
+            const double term = std::exp(-2.0 * kw * (kw + y - x) / variance) + std::exp(-2.0 * kw * (kw - y + x) / variance)
+                              - std::exp(-2.0 * (kw + x) * (kw + y) / variance) - std::exp(-2.0 * (x - kw) * (y - kw) / variance);
+            p += term;
+            if (std::abs(term) < 1e-17) break;
+        }
+        return std::clamp(p, 0.0, 1.0);
+    }
+
+    namespace {
+
+        double vanillaPrice(OptionType type, double S0, double K, double r, double sigma, double T) {
+            const double sd = sigma * std::sqrt(T);
+            const double d1 = (std::log(S0 / K) + r * T) / sd + 0.5 * sd, d2 = d1 - sd;
+            const double df = std::exp(-r * T);
+            return type == OptionType::Call ? S0 * cumulativeNormal(d1) - K * df * cumulativeNormal(d2)
+                                            : K * df * cumulativeNormal(-d2) - S0 * cumulativeNormal(-d1);
+        }
+
+        // Knock-out price; Haug (2007), "The Complete Guide to Option Pricing Formulas", §4.17.1.
+        double knockOutPrice(OptionType type, bool up, double S, double K, double H, double r, double sigma, double T) {
+            const double phi = type == OptionType::Call ? 1.0 : -1.0;
+            const double eta = up ? -1.0 : 1.0;
+            const double sd = sigma * std::sqrt(T);
+            const double mu = (r - 0.5 * sigma * sigma) / (sigma * sigma);
+            const double shift = (1.0 + mu) * sd;
+            const double df = std::exp(-r * T);
+
+            const double x1 = std::log(S / K) / sd + shift, x2 = std::log(S / H) / sd + shift;
+            const double y1 = std::log(H * H / (S * K)) / sd + shift, y2 = std::log(H / S) / sd + shift;
+            const double hs_spot = std::pow(H / S, 2.0 * (mu + 1.0)), hs_strike = std::pow(H / S, 2.0 * mu);
+
+            const double A = phi * S * cumulativeNormal(phi * x1) - phi * K * df * cumulativeNormal(phi * (x1 - sd));
+            const double B = phi * S * cumulativeNormal(phi * x2) - phi * K * df * cumulativeNormal(phi * (x2 - sd));
+            const double C = phi * S * hs_spot * cumulativeNormal(eta * y1) - phi * K * df * hs_strike * cumulativeNormal(eta * (y1 - sd));
+            const double D = phi * S * hs_spot * cumulativeNormal(eta * y2) - phi * K * df * hs_strike * cumulativeNormal(eta * (y2 - sd));
+
+            const bool call = type == OptionType::Call;
+            if (call && !up) return K > H ? A - C : B - D;
+            if (call && up) return K > H ? 0.0 : A - B + C - D;
+            if (!up) return K > H ? A - B + C - D : 0.0;
+            return K > H ? B - D : A - C;
+        }
+
+    }
+
+    double barrierPrice(OptionType type, BarrierType barrier_type, double S0, double K, double barrier,
+                        double r, double sigma, double T) {
+        const bool up = barrier_type == BarrierType::UpAndOut || barrier_type == BarrierType::UpAndIn;
+        const bool knock_in = barrier_type == BarrierType::UpAndIn || barrier_type == BarrierType::DownAndIn;
+        const bool knocked = up ? S0 >= barrier : S0 <= barrier;
+        const double vanilla = vanillaPrice(type, S0, K, r, sigma, T);
+        const double out = knocked ? 0.0 : std::max(knockOutPrice(type, up, S0, K, barrier, r, sigma, T), 0.0);
+        return knock_in ? vanilla - out : out;
+    }
+
+}
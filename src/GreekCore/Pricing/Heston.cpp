@@ -0,0 +1,150 @@
+#include "GreekCore/Pricing/Heston.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <stdexcept>
+
+namespace GreekCore {
+
+    namespace {
+
+        void validate(const HestonParameters& h) {
+            if (!(h.v0 >= 0.0) || !(h.kappa > 0.0) || !(h.theta >= 0.0) || !(h.xi > 0.0) || !(h.rho >= -1.0 && h.rho <= 1.0)) {
+                throw std::invalid_argument("Heston parameters need v0, theta >= 0, kappa, xi > 0 and |rho| <= 1");
+            }
+        }
+
+        // E[exp(i u X_T)] with X_T = ln(S_T / F_T), for complex u ("little trap" form).
+        std::complex<double> characteristicFunction(std::complex<double> u, double T, const HestonParameters& h) {
+            const std::complex<double> i(0.0, 1.0);
+            const std::complex<double> beta = h.kappa - h.rho * h.xi * i * u;
+            const std::complex<double> d = std::sqrt(beta * beta + h.xi * h.xi * (i * u + u * u));
+            const std::complex<double> g = (beta - d) / (beta + d);
+            const std::complex<double> e = std::exp(-d * T);
+            const std::complex<double> C = h.kappa * h.theta / (h.xi * h.xi) *
+                                           ((beta - d) * T - 2.0 * std::log((1.0 - g * e) / (1.0 - g)));
+            const std::complex<double> D = (beta - d) / (h.xi * h.xi) * (1.0 - e) / (1.0 - g * e);
+            return std::exp(C + D * h.v0);
+        }
+
+        // 8-point Gauss-Legendre rule on [a, b].
+        template<typename F>
+        double gaussLegendre8(const F& f, double a, double b) {
+            static constexpr double nodes[4] = {0.1834346424956498, 0.5255324099163290, 0.7966664774136267, 0.9602898564975363};
+            static constexpr double weights[4] = {0.3626837833783620, 0.3137066458778873, 0.2223810344533745, 0.1012285362903763};
+            const double mid = 0.5 * (a + b), half = 0.5 * (b - a);
+            double sum = 0.0;
+            for (int i = 0; i < 4; ++i) sum += weights[i] * (f(mid - half * nodes[i]) + f(mid + half * nodes[i]));
+            return half * sum;
+        }
+
+        // Bisects until the halves agree with the whole to `tolerance` (or `depth` runs out).
+        template<typename F>
+        double adaptiveGaussLegendre(const F& f, double a, double b, double whole, double tolerance, int depth) {
+            const double mid = 0.5 * (a + b);
+            const double left = gaussLegendre8(f, a, mid), right = gaussLegendre8(f, mid, b);
+            if (depth <= 0 || std::abs(left + right - whole) <= tolerance) return left + right;
+            return adaptiveGaussLegendre(f, a, mid, left, 0.5 * tolerance, depth - 1) +
+                   adaptiveGaussLegendre(f, mid, b, right, 0.5 * tolerance, depth - 1);
+        }
+    }
+
+    double hestonPrice(OptionType type, double S0, double K, double r, double T, const HestonParameters& heston) {
+        validate(heston);
+        if (!(T > 0.0)) {
+            const double intrinsic = (type == OptionType::Call) ? S0 - K : K - S0;
+            return std::max(intrinsic, 0.0);
+        }
+
+        // Lewis: C = S0 - sqrt(S0 K) e^{-rT/2} / pi * int_0^inf Re[e^{iuk} phi(u - i/2)] / (u^2 + 1/4) du,
+        // k = ln(F / K). Integrated over x in [0, 1) with u = x / (1 - x).
+        const double k = std::log(S0 / K) + r * T;
+        auto integrand = [&](double x) {
+            const double u = x / (1.0 - x);
+            const std::complex<double> phi = characteristicFunction(std::complex<double>(u, -0.5), T, heston);
+            const double value = (std::exp(std::complex<double>(0.0, u * k)) * phi).real() / (u * u + 0.25);
+            const double mapped = value / ((1.0 - x) * (1.0 - x));
+            return std::isfinite(mapped) ? mapped : 0.0; // phi underflows far in the tail
+        };
+        const double integral = adaptiveGaussLegendre(integrand, 0.0, 1.0, gaussLegendre8(integrand, 0.0, 1.0), 1e-13, 12);
+
+        const double call = S0 - std::sqrt(S0 * K) * std::exp(-0.5 * r * T) / std::numbers::pi * integral;
+        if (type == OptionType::Call) return call;
+        return call - S0 + K * std::exp(-r * T); // put-call parity
+    }
+
+    HestonQEScheme::HestonQEScheme(const HestonParameters& heston, const Parameters& r, const TimeGrid& grid,
+                                   double max_time_step)
+        : m_interval_steps(grid.size()), m_theta(heston.theta), m_v0(heston.v0),
+          m_discount(std::exp(-r.integral(0.0, grid.maturity()))) {
+        validate(heston);
+        const double kappa = heston.kappa, theta = heston.theta, xi = heston.xi, rho = heston.rho;
+
+        double t_prev = 0.0;
+        for (size_t j = 0; j < grid.size(); ++j) {
+            const double interval = grid[j] - t_prev;
+            const size_t n = (max_time_step > 0.0) ? static_cast<size_t>(std::ceil(interval / max_time_step - 1e-12)) : 1;
+            m_interval_steps[j] = std::max<size_t>(n, 1);
+            const double dt = interval / m_interval_steps[j];
+
+            for (size_t s = 0; s < m_interval_steps[j]; ++s) {
+                const double t0 = t_prev + s * dt;
+                const double t1 = (s + 1 == m_interval_steps[j]) ? grid[j] : t0 + dt;
+                Step step;
+                step.decay = std::exp(-kappa * dt);
+                step.s2_v = xi * xi * step.decay * (1.0 - step.decay) / kappa;
+                step.s2_c = theta * xi * xi * (1.0 - step.decay) * (1.0 - step.decay) / (2.0 * kappa);
+                step.drift = r.integral(t0, t1);
+                step.k0 = -rho * kappa * theta * dt / xi;
+                step.k1 = 0.5 * dt * (kappa * rho / xi - 0.5) - rho / xi;
+                step.k2 = 0.5 * dt * (kappa * rho / xi - 0.5) + rho / xi;
+                step.k3 = 0.5 * dt * (1.0 - rho * rho);
+                step.k4 = step.k3;
+                m_steps.push_back(step);
+            }
+            t_prev = grid[j];
+        }
+    }
+
+    void HestonQEScheme::advance(size_t k, double& log_spot, double& variance, double z_v, double z_x) const {
+        constexpr double psi_critical = 1.5;
+        const Step& s = m_steps[k];
+        const double v = variance;
+
+        const double m = m_theta * (1.0 - s.decay) + s.decay * v;
+        const double s2 = s.s2_v * v + s.s2_c;
+        const double psi = s2 / (m * m);
+        const double A = s.k2 + 0.5 * s.k4;
+
+        double v_next;
+        double k0 = s.k0;
+        if (m <= 0.0) {
+            v_next = 0.0;
+        } else if (psi <= psi_critical) {
+            // Quadratic: v' = a (b + Z)^2.
+            const double inv_psi = 2.0 / psi;
+            const double b2 = inv_psi - 1.0 + std::sqrt(inv_psi) * std::sqrt(inv_psi - 1.0);
+            const double a = m / (1.0 + b2);
+            const double b = std::sqrt(b2);
+            v_next = a * (b + z_v) * (b + z_v);
+            if (A * a < 0.5) {
+                k0 = -A * b2 * a / (1.0 - 2.0 * A * a) + 0.5 * std::log(1.0 - 2.0 * A * a) - (s.k1 + 0.5 * s.k3) * v;
+            }
+        } else {
+            // Exponential mixture: mass p at zero, exponential tail of rate beta.
+            const double p = (psi - 1.0) / (psi + 1.0);
+            const double beta = (1.0 - p) / m;
+            const double u = cumulativeNormal(z_v);
+            v_next = (u <= p) ? 0.0 : std::log((1.0 - p) / (1.0 - u)) / beta;
+            if (A < beta) {
+                k0 = -std::log(p + beta * (1.0 - p) / (beta - A)) - (s.k1 + 0.5 * s.k3) * v;
+            }
+        }
+
+        log_spot += s.drift + k0 + s.k1 * v + s.k2 * v_next + std::sqrt(s.k3 * v + s.k4 * v_next) * z_x;
+        variance = v_next;
+    }
+
+}
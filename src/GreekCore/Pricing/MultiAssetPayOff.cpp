@@ -0,0 +1,31 @@
+#include "GreekCore/Pricing/MultiAssetPayOff.h"
+#include <algorithm>
+
+namespace GreekCore {
+
+    namespace {
+        double vanilla(OptionType type, double underlying, double strike) {
+            return (type == OptionType::Call) ? std::max(underlying - strike, 0.0) : std::max(strike - underlying, 0.0);
+        }
+    }
+
+    double PayOffBasket::operator()(std::span<const double> spots) const {
+        double basket = 0.0;
+        for (size_t i = 0; i < m_weights.size(); ++i) basket += m_weights[i] * spots[i];
+        return vanilla(m_type, basket, m_strike);
+    }
+
+    double PayOffSpread::operator()(std::span<const double> spots) const {
+        return vanilla(m_type, spots[0] - spots[1], m_strike);
+    }
+
+    double PayOffRainbow::operator()(std::span<const double> spots) const {
+        double performance = spots[0] / m_initial[0];
+        for (size_t i = 1; i < m_initial.size(); ++i) {
+            const double p = spots[i] / m_initial[i];
+            performance = (m_rainbow == RainbowType::BestOf) ? std::max(performance, p) : std::min(performance, p);
+        }
+        return vanilla(m_type, performance, m_strike);
+    }
+
+}
@@ -1,4 +1,7 @@
 #include "GreekCore/Pricing/Parameters.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
 
 namespace GreekCore {
 
@@ -17,6 +20,71 @@ namespace GreekCore {
         return (time2 - time1) * m_constantSq;
     }
 
+    void ParametersConstant::integralGradient(double time1, double time2, std::span<double> gradient) const {
+        gradient[0] = time2 - time1;
+    }
+
+    void ParametersConstant::integralSquareGradient(double time1, double time2, std::span<double> gradient) const {
+        gradient[0] = 2.0 * m_constant * (time2 - time1);
+    }
+
+    ParametersPiecewiseConstant::ParametersPiecewiseConstant(std::vector<double> times, std::vector<double> values)
+        : m_times(std::move(times)), m_values(std::move(values)) {
+        if (m_times.empty() || m_times.size() != m_values.size()) {
+            throw std::invalid_argument("Piecewise constant parameter needs one value per time");
+        }
+        if (m_times.front() <= 0.0 || !std::is_sorted(m_times.begin(), m_times.end(), std::less_equal<double>())) {
+            throw std::invalid_argument("Piecewise constant times must be positive and strictly increasing");
+        }
+    }
+
+    std::unique_ptr<ParametersInner> ParametersPiecewiseConstant::clone() const {
+        return std::make_unique<ParametersPiecewiseConstant>(*this);
+    }
+
+    void ParametersPiecewiseConstant::overlaps(double time1, double time2, std::span<double> overlap) const {
+        double start = 0.0;
+        const size_t last = m_values.size() - 1;
+        for (size_t i = 0; i <= last; ++i) {
+            double end = (i == last) ? std::max(time2, m_times[i]) : m_times[i];
+            overlap[i] = std::max(0.0, std::min(end, time2) - std::max(start, time1));
+            start = end;
+        }
+    }
+
+    double ParametersPiecewiseConstant::integral(double time1, double time2) const {
+        double result = 0.0;
+        double start = 0.0;
+        const size_t last = m_values.size() - 1;
+        for (size_t i = 0; i <= last && start < time2; ++i) {
+            double end = (i == last) ? std::max(time2, m_times[i]) : m_times[i];
+            result += m_values[i] * std::max(0.0, std::min(end, time2) - std::max(start, time1));
+            start = end;
+        }
+        return result;
+    }
+
+    double ParametersPiecewiseConstant::integralSquare(double time1, double time2) const {
+        double result = 0.0;
+        double start = 0.0;
+        const size_t last = m_values.size() - 1;
+        for (size_t i = 0; i <= last && start < time2; ++i) {
+            double end = (i == last) ? std::max(time2, m_times[i]) : m_times[i];
+            result += m_values[i] * m_values[i] * std::max(0.0, std::min(end, time2) - std::max(start, time1));
+            start = end;
+        }
+        return result;
+    }
+
+    void ParametersPiecewiseConstant::integralGradient(double time1, double time2, std::span<double> gradient) const {
+        overlaps(time1, time2, gradient);
+    }
+
+    void ParametersPiecewiseConstant::integralSquareGradient(double time1, double time2, std::span<double> gradient) const {
+        overlaps(time1, time2, gradient);
+        for (size_t i = 0; i < m_values.size(); ++i) gradient[i] *= 2.0 * m_values[i];
+    }
+
     Parameters::Parameters(double constant) {
         m_inner = std::make_unique<ParametersConstant>(constant);
     }
@@ -59,4 +127,20 @@ namespace GreekCore {
         return std::sqrt(integralSquare(time1, time2) / dt);
     }
 
+    size_t Parameters::nodeCount() const {
+        return m_inner->nodeCount();
+    }
+
+    double Parameters::node(size_t index) const {
+        return m_inner->node(index);
+    }
+
+    void Parameters::integralGradient(double time1, double time2, std::span<double> gradient) const {
+        m_inner->integralGradient(time1, time2, gradient);
+    }
+
+    void Parameters::integralSquareGradient(double time1, double time2, std::span<double> gradient) const {
+        m_inner->integralSquareGradient(time1, time2, gradient);
+    }
+
 }
@@ -1,4 +1,5 @@
 #include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Numerics/AAD.h"
 
 namespace GreekCore {
 
@@ -10,6 +11,22 @@ namespace GreekCore {
         }
     }
 
+    Number PayOffVanilla::implementation(const Number& spot) const {
+        switch (m_type) {
+            case OptionType::Call: return max(spot - m_strike, 0.0);
+            case OptionType::Put:  return max(m_strike - spot, 0.0);
+            default: return 0.0;
+        }
+    }
+
+    double PayOffVanilla::derivativeImplementation(double spot) const {
+        switch (m_type) {
+            case OptionType::Call: return (spot > m_strike) ? 1.0 : 0.0;
+            case OptionType::Put:  return (spot < m_strike) ? -1.0 : 0.0;
+            default: return 0.0;
+        }
+    }
+
     double PayOffDigital::implementation(double spot) const {
         switch (m_type) {
             case OptionType::Call: return (spot > m_strike) ? 1.0 : 0.0;
@@ -18,10 +35,18 @@ namespace GreekCore {
         }
     }
 
+    Number PayOffDigital::implementation(const Number& spot) const {
+        return implementation(spot.value());
+    }
+
     double PayOffDoubleDigital::implementation(double spot) const {
         return (spot > m_lower && spot < m_upper) ? 1.0 : 0.0;
     }
 
+    Number PayOffDoubleDigital::implementation(const Number& spot) const {
+        return implementation(spot.value());
+    }
+
     double PayOffAsian::implementation(const std::vector<double>& spot_path) const {
         if (spot_path.empty()) return 0.0;
         double sum = std::accumulate(spot_path.begin(), spot_path.end(), 0.0);
@@ -33,4 +58,43 @@ namespace GreekCore {
             default: return 0.0;
         }
     }
+
+    Number PayOffAsian::implementation(const std::vector<Number>& spot_path) const {
+        if (spot_path.empty()) return 0.0;
+        Number sum = 0.0;
+        for (const Number& spot : spot_path) sum += spot;
+        Number avg = sum / static_cast<double>(spot_path.size());
+
+        switch (m_type) {
+            case OptionType::Call: return max(avg - m_strike, 0.0);
+            case OptionType::Put:  return max(m_strike - avg, 0.0);
+            default: return 0.0;
+        }
+    }
+
+    double PayOffGeometricAsian::implementation(const std::vector<double>& spot_path) const {
+        if (spot_path.empty()) return 0.0;
+        double log_sum = 0.0;
+        for (double spot : spot_path) log_sum += std::log(spot);
+        double avg = std::exp(log_sum / spot_path.size());
+
+        switch (m_type) {
+            case OptionType::Call: return std::max(avg - m_strike, 0.0);
+            case OptionType::Put:  return std::max(m_strike - avg, 0.0);
+            default: return 0.0;
+        }
+    }
+
+    Number PayOffGeometricAsian::implementation(const std::vector<Number>& spot_path) const {
+        if (spot_path.empty()) return 0.0;
+        Number log_sum = 0.0;
+        for (const Number& spot : spot_path) log_sum += log(spot);
+        Number avg = exp(log_sum / static_cast<double>(spot_path.size()));
+
+        switch (m_type) {
+            case OptionType::Call: return max(avg - m_strike, 0.0);
+            case OptionType::Put:  return max(m_strike - avg, 0.0);
+            default: return 0.0;
+        }
+    }
 }
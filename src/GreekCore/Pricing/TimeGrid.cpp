@@ -0,0 +1,52 @@
+#include "GreekCore/Pricing/TimeGrid.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace GreekCore {
+
+    TimeGrid::TimeGrid(double maturity, size_t steps) : m_times(steps), m_maturity(maturity), m_uniform(true) {
+        if (steps == 0 || !(maturity > 0.0)) {
+            throw std::invalid_argument("Time grid needs at least one step and a positive maturity");
+        }
+        double dt = maturity / steps;
+        double current_time = 0.0;
+        for (size_t j = 0; j < steps; ++j) {
+            current_time += dt;
+            m_times[j] = current_time;
+        }
+    }
+
+    TimeGrid::TimeGrid(std::vector<double> times) : m_times(std::move(times)), m_maturity(0.0), m_uniform(false) {
+        if (m_times.empty()) throw std::invalid_argument("Time grid needs at least one time");
+        double prev = 0.0;
+        for (double t : m_times) {
+            if (!(t > prev)) throw std::invalid_argument("Time grid times must be positive and strictly increasing");
+            prev = t;
+        }
+        m_maturity = m_times.back();
+    }
+
+    TimeGrid TimeGrid::rescaled(double maturity) const {
+        if (m_uniform) return TimeGrid(maturity, size());
+        TimeGrid grid(*this);
+        const double scale = maturity / m_maturity;
+        for (double& t : grid.m_times) t *= scale;
+        grid.m_maturity = maturity;
+        return grid;
+    }
+
+    DriftDiffusionTable::DriftDiffusionTable(const TimeGrid& grid, const Parameters& r, const Parameters& sigma)
+        : m_drift(grid.size()), m_diffusion(grid.size()), m_discount(std::exp(-r.integral(0.0, grid.maturity()))) {
+        // Exact integration of r and sigma^2 over each step
+        double current_time = 0.0;
+        for (size_t j = 0; j < grid.size(); ++j) {
+            double next_time = grid[j];
+            double r_step = r.integral(current_time, next_time);
+            double vol_sq_step = sigma.integralSquare(current_time, next_time);
+            m_drift[j] = r_step - 0.5 * vol_sq_step;
+            m_diffusion[j] = std::sqrt(vol_sq_step);
+            current_time = next_time;
+        }
+    }
+
+}
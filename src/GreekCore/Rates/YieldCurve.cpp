@@ -1,7 +1,9 @@
 #include "GreekCore/Rates/YieldCurve.h"
 #include "GreekCore/Numerics/BrentSolver.h"
+#include "GreekCore/Numerics/AAD.h"
 #include <stdexcept>
 #include <cmath>
+#include <type_traits>
 
 namespace GreekCore {
 
@@ -20,6 +22,8 @@ namespace GreekCore {
         log_dfs_.reserve(instruments.size() + 1);
         times_.push_back(0.0);
         log_dfs_.push_back(0.0);
+        quote_jacobian_.reserve(instruments.size() + 1);
+        quote_jacobian_.emplace_back(instruments.size(), 0.0);
 
         for (const auto& instr : instruments) {
             double t_i = day_count_convention_(ref_date_, instr.maturity_date);
@@ -84,28 +88,40 @@ namespace GreekCore {
             accrual = day_count_convention_(instr.start_date, instr.maturity_date);
         }
 
-        auto pricer = [&](double trial_log_df) -> double {
+        // Par pricer of the instrument as a function of the trial pillar, the quote and the known
+        // pillars; evaluated on doubles for the root search and on Numbers for the Jacobian.
+        auto pricer = [&]<typename Real>(const Real& trial_log_df, const Real& R, std::span<const Real> known_log_dfs) -> Real {
+            using std::exp;
             double prev_time = times_.back();
-            double prev_log_df = log_dfs_.back();
+            const Real& prev_log_df = known_log_dfs.back();
 
-            auto calc_df = [&](double t) {
+            auto calc_df = [&](double t) -> Real {
                 if (t <= prev_time) {
-                    return std::exp(interpolator_.interpolate(t, times_, log_dfs_));
+                    if constexpr (std::is_same_v<Real, double>) {
+                        return std::exp(interpolator_.interpolate(t, times_, log_dfs_));
+                    } else {
+                        std::vector<double> weights = interpolationWeights(t);
+                        Real log_df = 0.0;
+                        for (size_t j = 0; j < weights.size(); ++j) {
+                            if (weights[j] != 0.0) log_df = log_df + weights[j] * known_log_dfs[j];
+                        }
+                        return exp(log_df);
+                    }
                 }
-                double slope = (trial_log_df - prev_log_df) / (T - prev_time);
-                double val = prev_log_df + slope * (t - prev_time);
-                return std::exp(val);
+                Real slope = (trial_log_df - prev_log_df) / (T - prev_time);
+                Real val = prev_log_df + slope * (t - prev_time);
+                return exp(val);
             };
 
-            double df_start = calc_df(T_start);
-            double df_end = std::exp(trial_log_df); 
+            Real df_start = calc_df(T_start);
+            Real df_end = exp(trial_log_df); 
 
             if (instr.type == InstrumentType::Swap) {
                 using namespace std::chrono;
                 int freq = instr.frequency;
                 months period_duration{12 / freq};
                 
-                double pv_legs = 0.0;
+                Real pv_legs = 0.0;
                 Date payment_date = instr.maturity_date;
                 Date start_of_period;
 
@@ -129,14 +145,69 @@ namespace GreekCore {
         double min_log = -T * 2.0; 
         double max_log = T * 0.1;
 
-        double root = BrentSolver::solve(pricer, min_log, max_log);
+        double root = BrentSolver::solve([&](double trial_log_df) {
+            return pricer(trial_log_df, R, std::span<const double>(log_dfs_));
+        }, min_log, max_log);
 
         if (std::isnan(root)) {
             throw std::runtime_error("Bootstrap failed to converge");
         }
 
+        // Implicit function theorem: F(x_i, R_i, x_0..x_{i-1}) = 0 at the root, hence
+        // dx_i/dR_q = -(dF/dR_i [q == i] + sum_j dF/dx_j dx_j/dR_q) / (dF/dx_i).
+        Tape& tape = Tape::local();
+        const size_t tape_start = tape.size();
+        Number x = Number::input(root);
+        Number quote = Number::input(R);
+        std::vector<Number> known(log_dfs_.size());
+        for (size_t j = 0; j < known.size(); ++j) known[j] = Number::input(log_dfs_[j]);
+
+        Number F = pricer(x, quote, std::span<const Number>(known));
+        F.setAdjoint(1.0);
+        tape.propagate(tape_start, tape.size());
+
+        const size_t quote_index = times_.size() - 1;
+        const double dF_dx = x.adjoint();
+        std::vector<double> row(quote_jacobian_.front().size(), 0.0);
+        row[quote_index] = quote.adjoint();
+        for (size_t j = 0; j < known.size(); ++j) {
+            const double dF_dxj = known[j].adjoint();
+            if (dF_dxj == 0.0) continue;
+            for (size_t q = 0; q < row.size(); ++q) row[q] += dF_dxj * quote_jacobian_[j][q];
+        }
+        for (double& value : row) value /= -dF_dx;
+        tape.rewind(tape_start);
+
         times_.push_back(T);
         log_dfs_.push_back(root);
+        quote_jacobian_.push_back(std::move(row));
+    }
+
+    template<DayCountStrategy DC, InterpolatorStrategy Interp>
+    std::vector<double> YieldCurve<DC, Interp>::interpolationWeights(double t) const {
+        std::vector<double> unit(times_.size(), 0.0);
+        std::vector<double> weights(times_.size());
+        for (size_t j = 0; j < times_.size(); ++j) {
+            unit[j] = 1.0;
+            weights[j] = interpolator_.interpolate(t, times_, unit);
+            unit[j] = 0.0;
+        }
+        return weights;
+    }
+
+    /// @brief Sensitivities of the discount factor at t to every instrument quote.
+    /// @param t Time in years from reference date.
+    /// @return dP(0, t)/dR_q for each instrument q, in input order.
+    template<DayCountStrategy DC, InterpolatorStrategy Interp>
+    std::vector<double> YieldCurve<DC, Interp>::getDiscountFactorSensitivities(double t) const {
+        const double df = getDiscountFactor(t);
+        const std::vector<double> weights = interpolationWeights(t);
+        std::vector<double> sensitivities(quote_jacobian_.front().size(), 0.0);
+        for (size_t j = 0; j < weights.size(); ++j) {
+            if (weights[j] == 0.0) continue;
+            for (size_t q = 0; q < sensitivities.size(); ++q) sensitivities[q] += df * weights[j] * quote_jacobian_[j][q];
+        }
+        return sensitivities;
     }
     
     // Explicit instantiations
@@ -0,0 +1,106 @@
+#include "GreekCore/Utils/ThreadPool.h"
+
+#include <algorithm>
+
+namespace GreekCore {
+
+    namespace {
+        // Pool and deque of the calling worker thread (nullptr on other threads).
+        thread_local const ThreadPool* t_pool = nullptr;
+        thread_local size_t t_index = 0;
+    }
+
+    ThreadPool::ThreadPool(size_t threads) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 0; i <= threads; ++i) m_queues.push_back(std::make_unique<TaskQueue>());
+
+        m_workers.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            m_workers.emplace_back([this, i]() { workerLoop(i); });
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        m_workers.clear(); // join
+    }
+
+    ThreadPool& ThreadPool::global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    size_t ThreadPool::localQueue() const {
+        return t_pool == this ? t_index : injectionQueue();
+    }
+
+    void ThreadPool::execute(std::function<void()> task) {
+        TaskQueue& queue = *m_queues[localQueue()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        m_pending.fetch_add(1, std::memory_order_release);
+        {
+            // Pairs with the predicate check in workerLoop(): no wake-up can be lost.
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        }
+        m_wake.notify_one();
+    }
+
+    bool ThreadPool::popTask(size_t self, std::function<void()>& task) {
+        // Own deque: newest first.
+        if (self != injectionQueue()) {
+            TaskQueue& own = *m_queues[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+        // Then the injection queue and the other workers' deques: oldest first.
+        const size_t n = m_queues.size();
+        for (size_t k = 1; k <= n; ++k) {
+            TaskQueue& victim = *m_queues[(self + k) % n];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool ThreadPool::tryRunPendingTask() {
+        std::function<void()> task;
+        if (!popTask(localQueue(), task)) return false;
+        m_pending.fetch_sub(1, std::memory_order_relaxed);
+        task();
+        return true;
+    }
+
+    void ThreadPool::workerLoop(size_t index) {
+        t_pool = this;
+        t_index = index;
+
+        std::function<void()> task;
+        while (true) {
+            if (popTask(index, task)) {
+                m_pending.fetch_sub(1, std::memory_order_relaxed);
+                task();
+                task = nullptr;
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleep_mutex);
+            m_wake.wait(lock, [this]() { return m_stop || m_pending.load(std::memory_order_acquire) > 0; });
+            if (m_stop && m_pending.load(std::memory_order_acquire) == 0) return;
+        }
+    }
+
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/Statistics.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Built as its own executable (GreekCoreAllocationTests): the replaced global allocator
+// below counts every heap allocation and must not leak into the main unit test binary.
+
+using namespace GreekCore;
+
+namespace {
+    std::atomic<size_t> g_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+TEST(StatisticsTest, SnapshotsDoNotAllocate) {
+    StatisticsMean mean;
+    StatisticsMeanLockFree lock_free;
+    StatisticsThreadSafe<StatisticsMean> thread_safe(mean);
+    std::vector<unsigned long> stopping_points;
+    for (unsigned long p = 100; p <= 10000; p += 100) stopping_points.push_back(p);
+    StatisticsConvergence<StatisticsMean> convergence(mean, stopping_points);
+
+    const size_t before = g_allocations.load();
+    GathererSnapshot snap;
+    for (int i = 0; i < 10000; ++i) {
+        const double x = 0.001 * i;
+        mean.dumpOneResult(x);
+        lock_free.dumpOneResult(x);
+        thread_safe.dumpOneResult(x);
+        convergence.dumpOneResult(x); // logs 100 stopping points
+        if (i % 100 == 0) {
+            mean.snapshot(snap);
+            lock_free.snapshot(snap);
+            thread_safe.snapshot(snap);
+            convergence.snapshot(snap);
+            takeSnapshot(mean, snap);
+        }
+    }
+    EXPECT_EQ(g_allocations.load(), before);
+    EXPECT_EQ(convergence.getSnapshotLog().size(), stopping_points.size());
+}
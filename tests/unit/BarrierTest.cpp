@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Pricing/Barrier.h"
+#include "GreekCore/Pricing/MonteCarlo.h"
+#include "GreekCore/Pricing/StreamingPayOff.h"
+#include <cmath>
+
+using namespace GreekCore;
+
+TEST(BarrierTest, BridgeSurvivalProbability) {
+    // 1 - exp(-2 ln(H/s1) ln(H/s2) / v)
+    EXPECT_NEAR(bridgeSurvivalProbability(110.0, true, 100.0, 105.0, 0.01),
+                1.0 - std::exp(-2.0 * std::log(1.1) * std::log(110.0 / 105.0) / 0.01), 1e-15);
+    EXPECT_EQ(bridgeSurvivalProbability(110.0, true, 100.0, 111.0, 0.01), 0.0);
+    EXPECT_EQ(bridgeSurvivalProbability(90.0, false, 100.0, 95.0, 0.0), 1.0);
+
+    // A far second barrier does not change the single-barrier probability; the corridor
+    // probability is below both single-barrier ones.
+    const double down = bridgeSurvivalProbability(90.0, false, 100.0, 95.0, 0.02);
+    const double up = bridgeSurvivalProbability(110.0, true, 100.0, 95.0, 0.02);
+    EXPECT_NEAR(bridgeSurvivalProbability(90.0, 1e6, 100.0, 95.0, 0.02), down, 1e-15);
+    const double corridor = bridgeSurvivalProbability(90.0, 110.0, 100.0, 95.0, 0.02);
+    EXPECT_LT(corridor, std::min(down, up));
+    EXPECT_GT(corridor, down + up - 1.0);
+    EXPECT_EQ(bridgeSurvivalProbability(90.0, 110.0, 100.0, 89.0, 0.02), 0.0);
+}
+
+TEST(BarrierTest, ClosedFormParityAndLimits) {
+    const double vanilla_call = barrierPrice(OptionType::Call, BarrierType::UpAndIn, 100.0, 100.0, 100.0, 0.05, 0.2, 1.0);
+    for (BarrierType out : {BarrierType::UpAndOut, BarrierType::DownAndOut}) {
+        for (double H : {80.0, 95.0, 105.0, 130.0}) {
+            const bool up = out == BarrierType::UpAndOut;
+            if (up != (H > 100.0)) continue;
+            const BarrierType in = up ? BarrierType::UpAndIn : BarrierType::DownAndIn;
+            for (OptionType type : {OptionType::Call, OptionType::Put}) {
+                const double o = barrierPrice(type, out, 100.0, 100.0, H, 0.05, 0.2, 1.0);
+                const double i = barrierPrice(type, in, 100.0, 100.0, H, 0.05, 0.2, 1.0);
+                EXPECT_GE(o, 0.0);
+                EXPECT_GE(i, -1e-12);
+                if (type == OptionType::Call) {
+                    EXPECT_NEAR(o + i, vanilla_call, 1e-12);
+                }
+            }
+        }
+    }
+    // Up-and-out call struck above the barrier is worthless; a remote barrier leaves the vanilla.
+    EXPECT_EQ(barrierPrice(OptionType::Call, BarrierType::UpAndOut, 100.0, 120.0, 110.0, 0.05, 0.2, 1.0), 0.0);
+    EXPECT_NEAR(barrierPrice(OptionType::Call, BarrierType::UpAndOut, 100.0, 100.0, 1e4, 0.05, 0.2, 1.0), vanilla_call, 1e-10);
+    EXPECT_NEAR(barrierPrice(OptionType::Put, BarrierType::DownAndOut, 100.0, 100.0, 1e-2, 0.05, 0.2, 1.0),
+                barrierPrice(OptionType::Put, BarrierType::DownAndIn, 100.0, 100.0, 100.0, 0.05, 0.2, 1.0), 1e-10);
+}
+
+TEST(BarrierTest, BridgeCorrectedMonteCarloMatchesContinuousMonitoring) {
+    const Parameters sigma(0.2);
+    const double reference = barrierPrice(OptionType::Call, BarrierType::UpAndOut, 100.0, 100.0, 120.0, 0.05, 0.2, 1.0);
+    const size_t paths = 40000, weekly = 52;
+
+    auto corrected = MonteCarloPricer::pricePathDependent(100.0, 0.05, sigma, 1.0, paths, weekly,
+        StreamingBridgeBarrier(BarrierType::UpAndOut, 120.0, OptionType::Call, 100.0));
+    EXPECT_NEAR(corrected.price, reference, 4.0 * corrected.error_estimate);
+
+    // Discrete monitoring on the same paths misses crossings between the dates: biased high.
+    auto discrete = MonteCarloPricer::pricePathDependent(100.0, 0.05, sigma, 1.0, paths, weekly,
+        StreamingBarrier(BarrierType::UpAndOut, 120.0, OptionType::Call, 100.0));
+    EXPECT_GT(discrete.price - reference, 10.0 * corrected.error_estimate);
+
+    // Knock-in + knock-out = vanilla on every path.
+    auto knock_in = MonteCarloPricer::pricePathDependent(100.0, 0.05, sigma, 1.0, paths, weekly,
+        StreamingBridgeBarrier(BarrierType::UpAndIn, 120.0, OptionType::Call, 100.0));
+    const double vanilla = barrierPrice(OptionType::Call, BarrierType::UpAndIn, 100.0, 100.0, 100.0, 0.05, 0.2, 1.0);
+    EXPECT_NEAR(knock_in.price + corrected.price, vanilla, 4.0 * (knock_in.error_estimate + corrected.error_estimate));
+}
+
+TEST(BarrierTest, BridgeCorrectedVegaUsesBumpedVolatility) {
+    // The crossing probabilities take the step variance of each Greeks scenario's market.
+    const Parameters sigma(0.2);
+    auto vegaOf = [](double vol) {
+        const double h = 1e-4;
+        return (barrierPrice(OptionType::Call, BarrierType::UpAndOut, 100.0, 100.0, 120.0, 0.05, vol + h, 1.0)
+              - barrierPrice(OptionType::Call, BarrierType::UpAndOut, 100.0, 100.0, 120.0, 0.05, vol - h, 1.0)) / (2.0 * h);
+    };
+    MonteCarloSettings settings;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    for (size_t block : {size_t{1}, size_t{256}}) {
+        settings.path_block = block;
+        auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, sigma, 1.0, 1 << 16, 52,
+            StreamingBridgeBarrier(BarrierType::UpAndOut, 120.0, OptionType::Call, 100.0), settings);
+        EXPECT_NEAR(result.vega, vegaOf(0.2), 0.3) << "path_block " << block; // central difference with the 0.01 bump
+    }
+}
+
+TEST(BarrierTest, DoubleBarrier) {
+    const Parameters sigma(0.25);
+    const size_t paths = 20000, steps = 12;
+    auto price = [&](auto payoff) { return MonteCarloPricer::pricePathDependent(100.0, 0.03, sigma, 1.0, paths, steps, payoff); };
+
+    // A remote upper barrier: single down-and-out.
+    auto wide = price(StreamingDoubleBarrier(DoubleBarrierType::KnockOut, 85.0, 1e6, OptionType::Put, 100.0));
+    auto single = price(StreamingBridgeBarrier(BarrierType::DownAndOut, 85.0, OptionType::Put, 100.0));
+    EXPECT_NEAR(wide.price, single.price, 1e-12);
+    EXPECT_NEAR(single.price, barrierPrice(OptionType::Put, BarrierType::DownAndOut, 100.0, 100.0, 85.0, 0.03, 0.25, 1.0),
+                4.0 * single.error_estimate);
+
+    // The corridor is worth less than either single barrier; in + out = vanilla.
+    auto corridor = price(StreamingDoubleBarrier(DoubleBarrierType::KnockOut, 85.0, 120.0, OptionType::Put, 100.0));
+    auto corridor_in = price(StreamingDoubleBarrier(DoubleBarrierType::KnockIn, 85.0, 120.0, OptionType::Put, 100.0));
+    auto vanilla = price([](const std::vector<double>& path) { return std::max(100.0 - path.back(), 0.0); });
+    EXPECT_LT(corridor.price, single.price);
+    EXPECT_NEAR(corridor.price + corridor_in.price, vanilla.price, 1e-10);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/LeastSquares.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+#include "GreekCore/Numerics/Sobol.h"
+#include "GreekCore/Pricing/BinomialTree.h"
+#include "GreekCore/Pricing/MonteCarlo.h"
+#include "GreekCore/Pricing/PayOff.h"
+#include <cmath>
+#include <vector>
+
+using namespace GreekCore;
+
+TEST(EarlyExerciseTest, LeastSquaresFitsPolynomial) {
+    LeastSquares fit(3);
+    std::vector<double> phi(3);
+    for (int i = 0; i <= 20; ++i) {
+        const double x = 0.1 * i;
+        evaluateBasis(RegressionBasis::Polynomial, x, phi);
+        fit.add(phi, 1.0 - 2.0 * x + 0.5 * x * x);
+    }
+    const std::vector<double> beta = fit.solve();
+    EXPECT_NEAR(beta[0], 1.0, 1e-10);
+    EXPECT_NEAR(beta[1], -2.0, 1e-10);
+    EXPECT_NEAR(beta[2], 0.5, 1e-10);
+
+    // Split into two merged halves: same normal equations.
+    LeastSquares a(3), b(3);
+    for (int i = 0; i <= 20; ++i) {
+        evaluateBasis(RegressionBasis::Polynomial, 0.1 * i, phi);
+        (i % 2 ? a : b).add(phi, 1.0 - 2.0 * 0.1 * i + 0.5 * 0.01 * i * i);
+    }
+    a.merge(b);
+    EXPECT_EQ(a.count(), 21u);
+    EXPECT_NEAR(a.solve()[2], 0.5, 1e-10);
+}
+
+TEST(EarlyExerciseTest, LeastSquaresRankDeficient) {
+    // One distinct x: only the constant is identifiable, the other coefficients are 0.
+    LeastSquares fit(3);
+    std::vector<double> phi(3);
+    evaluateBasis(RegressionBasis::Polynomial, 2.0, phi);
+    fit.add(phi, 3.0);
+    fit.add(phi, 5.0);
+    const std::vector<double> beta = fit.solve();
+    EXPECT_NEAR(beta[0] + 2.0 * beta[1] + 4.0 * beta[2], 4.0, 1e-12);
+    EXPECT_EQ(LeastSquares(2).solve(), (std::vector<double>{0.0, 0.0}));
+
+    // Weighted Laguerre: e^{-x/2} {1, 1 - x, 1 - 2x + x^2 / 2}.
+    evaluateBasis(RegressionBasis::Laguerre, 0.5, phi);
+    EXPECT_NEAR(phi[2], std::exp(-0.25) * (1.0 - 1.0 + 0.125), 1e-15);
+}
+
+TEST(EarlyExerciseTest, AmericanPutMatchesBinomialTree) {
+    // Longstaff & Schwartz (2001), Table 1: S0 = 36, K = 40, r = 6%, sigma = 20%, T = 1.
+    PayOffVanilla put(OptionType::Put, 40.0);
+    const double tree = BinomialTreePricer::price(36.0, 0.06, 0.2, 1.0, 2000, put, ExerciseType::American).price;
+    const double european = BinomialTreePricer::price(36.0, 0.06, 0.2, 1.0, 2000, put, ExerciseType::European).price;
+
+    for (RegressionBasis basis : {RegressionBasis::Polynomial, RegressionBasis::Laguerre}) {
+        EarlyExerciseSettings lsm;
+        lsm.basis = basis;
+        auto result = MonteCarloPricer::priceAmerican(36.0, 0.06, 0.2, 1.0, 50, 100000, put, lsm);
+        // Low-biased by the fitted rule and by 50 exercise dates instead of continuous exercise.
+        EXPECT_NEAR(result.price, tree - 0.01, 4.0 * result.error_estimate + 0.02) << static_cast<int>(basis);
+        EXPECT_GT(result.price, european + 0.1);
+    }
+}
+
+TEST(EarlyExerciseTest, RegeneratedPathsMatchStoredMatrix) {
+    PayOffVanilla put(OptionType::Put, 100.0);
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 4096;
+    EarlyExerciseSettings lsm;
+    lsm.regression_paths = 20000;
+    auto stored = MonteCarloPricer::priceAmerican(100.0, 0.05, 0.3, 1.0, 12, 20000, put, lsm, settings);
+
+    lsm.memory_budget = 1024; // far below 20000 x 12 doubles
+    settings.threads = 3;
+    auto regenerated = MonteCarloPricer::priceAmerican(100.0, 0.05, 0.3, 1.0, 12, 20000, put, lsm, settings);
+    EXPECT_EQ(stored.price, regenerated.price);
+    EXPECT_EQ(stored.error_estimate, regenerated.error_estimate);
+}
+
+TEST(EarlyExerciseTest, SingleExerciseDateIsEuropean) {
+    PayOffVanilla call(OptionType::Call, 100.0);
+    auto result = MonteCarloPricer::priceBermudan(100.0, 0.03, 0.2, TimeGrid(1.0, 1), 200000, call);
+    const double d1 = (std::log(1.0) + (0.03 + 0.02) * 1.0) / 0.2, d2 = d1 - 0.2;
+    const double reference = 100.0 * 0.5 * std::erfc(-d1 / std::sqrt(2.0)) - 100.0 * std::exp(-0.03) * 0.5 * std::erfc(-d2 / std::sqrt(2.0));
+    EXPECT_NEAR(result.price, reference, 4.0 * result.error_estimate);
+}
+
+TEST(EarlyExerciseTest, QuasiRandomPricingContinuesAfterRegressionPoints) {
+    // One exercise date: the pricing pass is a European on Sobol points R, R + 1, ... where R
+    // covers the regression batches (3 batches of 1000 for 2500 regression paths).
+    PayOffVanilla put(OptionType::Put, 100.0);
+    MonteCarloSettings settings;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    settings.paths_per_batch = 1000;
+    EarlyExerciseSettings lsm;
+    lsm.regression_paths = 2500;
+    const size_t paths = 4000;
+    auto result = MonteCarloPricer::priceBermudan(100.0, 0.05, 0.2, TimeGrid(1.0, 1), paths, put, lsm, settings);
+
+    SobolSequence sobol(1, settings.scrambling, settings.seed);
+    sobol.skipTo(3000);
+    std::vector<double> u(1);
+    double sum = 0.0;
+    for (size_t p = 0; p < paths; ++p) {
+        sobol.next(u);
+        sum += std::exp(-0.05) * put(100.0 * std::exp(0.05 - 0.02 + 0.2 * inverseCumulativeNormal(u[0])));
+    }
+    EXPECT_NEAR(result.price, sum / paths, 1e-10);
+
+    // Quasi-random American put against the tree.
+    const double tree = BinomialTreePricer::price(36.0, 0.06, 0.2, 1.0, 2000, PayOffVanilla(OptionType::Put, 40.0), ExerciseType::American).price;
+    auto american = MonteCarloPricer::priceAmerican(36.0, 0.06, 0.2, 1.0, 50, 50000, PayOffVanilla(OptionType::Put, 40.0), lsm, settings);
+    EXPECT_NEAR(american.price, tree - 0.01, 0.03);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Pricing/Heston.h"
+#include "GreekCore/Pricing/MonteCarlo.h"
+#include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Pricing/StreamingPayOff.h"
+#include <cmath>
+#include <numbers>
+
+using namespace GreekCore;
+
+namespace {
+    double blackScholesCall(double S, double K, double r, double sigma, double T) {
+        auto N = [](double x) { return 0.5 * std::erfc(-x / std::numbers::sqrt2); };
+        double d1 = (std::log(S / K) + (r + 0.5 * sigma * sigma) * T) / (sigma * std::sqrt(T));
+        return S * N(d1) - K * std::exp(-r * T) * N(d1 - sigma * std::sqrt(T));
+    }
+
+    // Fang & Oosterlee (2008), COS method paper: reference call 5.785155450 (S0 = K = 100, r = 0, T = 1).
+    const HestonParameters kCosPaper{0.0175, 1.5768, 0.0398, 0.5751, -0.5711};
+}
+
+TEST(HestonTest, SemiAnalyticPrice) {
+    EXPECT_NEAR(hestonPrice(OptionType::Call, 100.0, 100.0, 0.0, 1.0, kCosPaper), 5.785155450, 1e-7);
+
+    // Constant variance (v0 = theta, tiny vol of variance): Black-Scholes.
+    const HestonParameters flat{0.04, 1.0, 0.04, 1e-4, 0.0};
+    for (double K : {80.0, 100.0, 125.0}) {
+        EXPECT_NEAR(hestonPrice(OptionType::Call, 100.0, K, 0.05, 2.0, flat), blackScholesCall(100.0, K, 0.05, 0.2, 2.0), 1e-6);
+    }
+
+    // Put-call parity.
+    const double call = hestonPrice(OptionType::Call, 100.0, 110.0, 0.03, 1.5, kCosPaper);
+    const double put = hestonPrice(OptionType::Put, 100.0, 110.0, 0.03, 1.5, kCosPaper);
+    EXPECT_NEAR(call - put, 100.0 - 110.0 * std::exp(-0.03 * 1.5), 1e-10);
+
+    EXPECT_THROW(hestonPrice(OptionType::Call, 100.0, 100.0, 0.0, 1.0, HestonParameters{0.04, -1.0, 0.04, 0.5, 0.0}), std::invalid_argument);
+}
+
+TEST(HestonTest, QuadraticExponentialMatchesSemiAnalytic) {
+    MonteCarloSettings settings;
+    settings.max_time_step = 1.0 / 32.0;
+    const size_t paths = 200000;
+
+    for (double K : {90.0, 100.0, 110.0}) {
+        PayOffVanilla call(OptionType::Call, K);
+        auto mc = MonteCarloPricer::priceHeston(100.0, 0.0, kCosPaper, 1.0, paths, call, settings);
+        const double reference = hestonPrice(OptionType::Call, 100.0, K, 0.0, 1.0, kCosPaper);
+        EXPECT_EQ(mc.paths, paths);
+        EXPECT_NEAR(mc.price, reference, 4.0 * mc.error_estimate) << "K = " << K;
+    }
+
+    // Martingale correction: the discounted forward is exact up to sampling error, even on coarse steps.
+    struct Forward {
+        double operator()(double spot) const { return spot; }
+    };
+    settings.max_time_step = 0.5;
+    const HestonParameters wild{0.09, 0.5, 0.09, 1.0, -0.9};
+    auto forward = MonteCarloPricer::priceHeston(100.0, 0.05, wild, 2.0, paths, Forward{}, settings);
+    EXPECT_NEAR(forward.price, 100.0, 4.0 * forward.error_estimate);
+}
+
+TEST(HestonTest, PathDependentPayOffsAndGatherers) {
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 1000;
+    settings.max_time_step = 1.0 / 48.0;
+    settings.antithetic = true;
+    const TimeGrid grid(1.0, 12);
+    const size_t paths = 5500;
+
+    PayOffAsian asian(OptionType::Call, 100.0);
+    auto vector_result = MonteCarloPricer::priceHeston(100.0, 0.03, kCosPaper, grid, paths, asian, settings);
+    auto streaming_result = MonteCarloPricer::priceHeston(100.0, 0.03, kCosPaper, grid, paths, StreamingAsian(OptionType::Call, 100.0), settings);
+    EXPECT_NEAR(vector_result.price, streaming_result.price, 1e-10);
+    EXPECT_GT(vector_result.price, 0.0);
+
+    // Thread count does not change the result.
+    MonteCarloSettings threaded = settings;
+    threaded.threads = 3;
+    auto threaded_result = MonteCarloPricer::priceHeston(100.0, 0.03, kCosPaper, grid, paths, asian, threaded);
+    EXPECT_EQ(threaded_result.price, vector_result.price);
+
+    StatisticsWelford gatherer;
+    MonteCarloPricer::priceHeston(100.0, 0.03, kCosPaper, grid, paths, asian, gatherer, threaded);
+    GathererSnapshot snap;
+    gatherer.snapshot(snap);
+    EXPECT_EQ(snap.paths, paths);
+    EXPECT_NEAR(snap.mean, vector_result.price, 1e-10);
+    EXPECT_NEAR(snap.std_error, vector_result.error_estimate, 1e-10);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Pricing/MonteCarlo.h"
+#include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+#include <cmath>
+#include <limits>
+
+using namespace GreekCore;
+
+namespace {
+    // e^{-rT} N(d2) for a digital call struck at K.
+    double digitalCall(double S0, double K, double r, double sigma, double T) {
+        const double d2 = (std::log(S0 / K) + (r - 0.5 * sigma * sigma) * T) / (sigma * std::sqrt(T));
+        return std::exp(-r * T) * cumulativeNormal(d2);
+    }
+}
+
+TEST(ImportanceSamplingTest, TruncatedNormalMean) {
+    const double inf = std::numeric_limits<double>::infinity();
+    EXPECT_EQ(truncatedNormalMean(-inf, inf), 0.0);
+    EXPECT_NEAR(truncatedNormalMean(0.0, inf), std::sqrt(2.0 / std::numbers::pi), 1e-15);
+    EXPECT_NEAR(truncatedNormalMean(-inf, 0.0), -std::sqrt(2.0 / std::numbers::pi), 1e-15);
+    EXPECT_NEAR(truncatedNormalMean(-1.0, 1.0), 0.0, 1e-15);
+    // Deep tail: mean just above the boundary, including once the mass underflows.
+    EXPECT_NEAR(truncatedNormalMean(8.0, inf), 8.0 + 1.0 / 8.0 - 2.0 / 512.0, 5e-4);
+    EXPECT_NEAR(truncatedNormalMean(50.0, inf), 50.0 + 1.0 / 50.0, 1e-3);
+    EXPECT_GE(truncatedNormalMean(3.0, 3.1), 3.0);
+    EXPECT_LE(truncatedNormalMean(3.0, 3.1), 3.1);
+}
+
+TEST(ImportanceSamplingTest, DeepOutOfTheMoneyDigital) {
+    // Strike 4.5 standard deviations above the forward: about 1 path in 300000 pays.
+    const double S0 = 100.0, K = 250.0, r = 0.02, sigma = 0.2, T = 1.0;
+    const double reference = digitalCall(S0, K, r, sigma, T);
+    const PayOffDigital payoff(OptionType::Call, K);
+
+    MonteCarloSettings plain;
+    MonteCarloSettings shifted = plain;
+    shifted.importance_sampling.automatic = true;
+
+    auto is = MonteCarloPricer::priceEuropean(S0, r, Parameters(sigma), T, 100000, payoff, shifted);
+    EXPECT_NEAR(is.price, reference, 4.0 * is.error_estimate);
+    EXPECT_LT(is.error_estimate, 0.02 * reference);
+
+    // Plain sampling of a 3.5 standard deviation strike: about 20 of the paths pay.
+    const PayOffDigital nearer(OptionType::Call, 200.0);
+    auto mc = MonteCarloPricer::priceEuropean(S0, r, Parameters(sigma), T, 100000, nearer, plain);
+    auto mc_is = MonteCarloPricer::priceEuropean(S0, r, Parameters(sigma), T, 100000, nearer, shifted);
+    EXPECT_NEAR(mc_is.price, digitalCall(S0, 200.0, r, sigma, T), 4.0 * mc_is.error_estimate);
+    EXPECT_GT(mc.error_estimate, 10.0 * mc_is.error_estimate);
+
+    // A fixed shift and antithetic pairs (reflected around the shift) stay unbiased.
+    MonteCarloSettings fixed = plain;
+    fixed.importance_sampling.shift = 4.0;
+    fixed.antithetic = true;
+    auto f = MonteCarloPricer::priceEuropean(S0, r, Parameters(sigma), T, 100000, payoff, fixed);
+    EXPECT_NEAR(f.price, reference, 4.0 * f.error_estimate);
+
+    // Gatherer overload.
+    StatisticsMean gatherer;
+    MonteCarloPricer::priceEuropean(S0, r, Parameters(sigma), T, 100000, payoff, gatherer, shifted.importance_sampling);
+    const auto stats = gatherer.getResultsSoFar();
+    EXPECT_NEAR(stats[0][0], reference, 4.0 * stats[0][1]);
+}
+
+TEST(ImportanceSamplingTest, DoubleDigitalAndGreeks) {
+    const double S0 = 100.0, r = 0.02, sigma = 0.2, T = 1.0;
+    const PayOffDoubleDigital payoff(170.0, 200.0);
+    const double reference = digitalCall(S0, 170.0, r, sigma, T) - digitalCall(S0, 200.0, r, sigma, T);
+
+    MonteCarloSettings settings;
+    settings.greeks = GreeksMode::Estimators;
+    settings.importance_sampling.automatic = true;
+    auto res = MonteCarloPricer::priceEuropean(S0, r, Parameters(sigma), T, 200000, payoff, settings);
+    EXPECT_NEAR(res.price, reference, 4.0 * res.error_estimate);
+    EXPECT_LT(res.error_estimate, 0.02 * reference);
+
+    // Likelihood-ratio delta of the shifted draws against a central difference of the closed form.
+    const double h = 1e-3;
+    const double delta = ((digitalCall(S0 + h, 170.0, r, sigma, T) - digitalCall(S0 + h, 200.0, r, sigma, T)) -
+                          (digitalCall(S0 - h, 170.0, r, sigma, T) - digitalCall(S0 - h, 200.0, r, sigma, T))) / (2.0 * h);
+    EXPECT_NEAR(res.delta, delta, 0.1 * delta);
+}
+
+TEST(ImportanceSamplingTest, ZeroShiftIsPlainSampling) {
+    const PayOffVanilla payoff(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.antithetic = true;
+    auto plain = MonteCarloPricer::priceEuropean(100.0, 0.05, Parameters(0.2), 1.0, 20000, payoff, settings);
+    settings.importance_sampling.shift = 0.0;
+    auto zero = MonteCarloPricer::priceEuropean(100.0, 0.05, Parameters(0.2), 1.0, 20000, payoff, settings);
+    EXPECT_EQ(plain.price, zero.price);
+    EXPECT_EQ(plain.delta, zero.delta);
+
+    // Payoffs without a region cannot pick the shift automatically.
+    auto squared = [](double spot) { return spot * spot; };
+    settings.importance_sampling.automatic = true;
+    EXPECT_THROW(MonteCarloPricer::priceEuropean(100.0, 0.05, Parameters(0.2), 1.0, 1000, squared, settings),
+                 std::invalid_argument);
+}
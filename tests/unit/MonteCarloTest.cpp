@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "GreekCore/Pricing/MonteCarlo.h"
 #include "GreekCore/Pricing/PayOff.h"
+#include "GreekCore/Pricing/StreamingPayOff.h"
+#include <array>
 #include <cmath>
 
 using namespace GreekCore;
@@ -44,6 +46,15 @@ TEST(MonteCarloTest, AntitheticVarianceReduction) {
     
     EXPECT_GT(result.price, 0.0);
     EXPECT_LT(result.price, S); 
+
+    MonteCarloSettings settings;
+    settings.antithetic = true;
+    auto plain = MonteCarloPricer::priceEuropean(S, 0.05, 0.2, 1.0, 20000, payoff);
+    auto anti = MonteCarloPricer::priceEuropean(S, 0.05, 0.2, 1.0, 20000, payoff, settings);
+
+    double exact = black_scholes_call(S, 110.0, 0.05, 0.2, 1.0);
+    EXPECT_NEAR(anti.price, exact, 3.0 * anti.error_estimate);
+    EXPECT_LT(anti.error_estimate, plain.error_estimate);
 }
 
 TEST(MonteCarloTest, PutOptionPricing) {
@@ -117,3 +128,494 @@ TEST(MonteCarloTest, GreeksAccuracy) {
     EXPECT_NEAR(result.rho, expected.rho, 2.0);
     EXPECT_NEAR(result.theta, expected.theta, 1.0);
 }
+
+TEST(MonteCarloTest, ParallelResultIsIndependentOfThreadCount) {
+    PayOffVanilla payoff(OptionType::Call, 100.0);
+
+    MonteCarloSettings serial;
+    serial.paths_per_batch = 5000;
+    auto base = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 50000, payoff, serial);
+
+    for (size_t threads : {2u, 3u, 8u}) {
+        MonteCarloSettings parallel = serial;
+        parallel.threads = threads;
+        auto result = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 50000, payoff, parallel);
+
+        EXPECT_EQ(result.price, base.price);
+        EXPECT_EQ(result.error_estimate, base.error_estimate);
+        EXPECT_EQ(result.delta, base.delta);
+        EXPECT_EQ(result.vega, base.vega);
+    }
+
+    double exact = black_scholes_call(100.0, 100.0, 0.05, 0.2, 1.0);
+    EXPECT_NEAR(base.price, exact, 3.0 * base.error_estimate);
+}
+
+TEST(MonteCarloTest, ParallelPathDependentIsIndependentOfThreadCount) {
+    PayOffAsian payoff(OptionType::Call, 100.0);
+
+    MonteCarloSettings serial;
+    serial.paths_per_batch = 1000;
+    auto base = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 4000, 12, payoff, serial);
+
+    MonteCarloSettings parallel = serial;
+    parallel.threads = 4;
+    auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 4000, 12, payoff, parallel);
+
+    EXPECT_EQ(result.price, base.price);
+    EXPECT_EQ(result.error_estimate, base.error_estimate);
+    EXPECT_GT(base.price, 0.0);
+}
+
+TEST(MonteCarloTest, QuasiRandomConvergesFasterThanStandardError) {
+    double S = 100.0, K = 100.0, r = 0.05, sigma = 0.2, T = 1.0;
+    PayOffVanilla payoff(OptionType::Call, K);
+
+    MonteCarloSettings settings;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    auto result = MonteCarloPricer::priceEuropean(S, r, sigma, T, 4096, payoff, settings);
+    double exact = black_scholes_call(S, K, r, sigma, T);
+
+    // The pseudo-random standard error at 4096 paths is ~0.23; Sobol does an order of magnitude better.
+    EXPECT_NEAR(result.price, exact, 0.02);
+}
+
+TEST(MonteCarloTest, QuasiRandomPathsAreIndependentOfThreadCount) {
+    PayOffAsian payoff(OptionType::Call, 100.0);
+
+    MonteCarloSettings serial;
+    serial.sampling = SamplingMethod::QuasiRandom;
+    serial.paths_per_batch = 512;
+    auto base = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 2048, 16, payoff, serial);
+
+    MonteCarloSettings parallel = serial;
+    parallel.threads = 3;
+    auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 2048, 16, payoff, parallel);
+
+    EXPECT_EQ(result.price, base.price);
+    EXPECT_EQ(result.delta, base.delta);
+}
+
+TEST(MonteCarloTest, TerminalSpotControlVariateReducesError) {
+    PayOffVanilla payoff(OptionType::Call, 100.0);
+
+    // Discounted S_T has expectation S0 under the risk-neutral measure.
+    auto spot = [](double S) { return S; };
+    ControlVariate<decltype(spot)> control{spot, [](double S0, const Parameters&, const Parameters&, double) { return S0; }};
+
+    auto plain = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 20000, payoff);
+    auto controlled = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 20000, payoff, control);
+
+    double exact = black_scholes_call(100.0, 100.0, 0.05, 0.2, 1.0);
+    EXPECT_NEAR(controlled.price, exact, 3.0 * controlled.error_estimate);
+    EXPECT_LT(controlled.error_estimate, 0.5 * plain.error_estimate);
+}
+
+TEST(MonteCarloTest, GeometricAsianClosedFormMatchesSimulation) {
+    PayOffGeometricAsian payoff(OptionType::Put, 100.0);
+    auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 20000, 12, payoff);
+
+    double exact = geometricAsianPrice(OptionType::Put, 100.0, 100.0, 0.05, 0.2, 1.0, 12);
+    EXPECT_NEAR(result.price, exact, 3.0 * result.error_estimate);
+}
+
+TEST(MonteCarloTest, ArithmeticAsianWithGeometricControl) {
+    PayOffAsian payoff(OptionType::Call, 100.0);
+    auto control = makeGeometricAsianControl(OptionType::Call, 100.0, 12);
+
+    auto plain = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 10000, 12, payoff);
+    auto controlled = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 10000, 12, payoff, control);
+
+    EXPECT_NEAR(controlled.price, plain.price, 3.0 * plain.error_estimate);
+    EXPECT_LT(controlled.error_estimate, 0.1 * plain.error_estimate);
+    EXPECT_GT(controlled.delta, 0.0);
+}
+
+TEST(MonteCarloTest, SinglePassGreeksMatchRepricing) {
+    PayOffVanilla payoff(OptionType::Put, 95.0);
+
+    MonteCarloSettings single;
+    single.paths_per_batch = 4096;
+    single.antithetic = true;
+    MonteCarloSettings repricing = single;
+    repricing.greeks = GreeksMode::Repricing;
+
+    auto a = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 10000, payoff, single);
+    auto b = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 10000, payoff, repricing);
+    EXPECT_EQ(a.price, b.price);
+    EXPECT_EQ(a.delta, b.delta);
+    EXPECT_EQ(a.gamma, b.gamma);
+    EXPECT_EQ(a.vega, b.vega);
+    EXPECT_EQ(a.rho, b.rho);
+    EXPECT_EQ(a.theta, b.theta);
+    EXPECT_EQ(a.error_estimate, b.error_estimate);
+
+    PayOffAsian asian(OptionType::Call, 100.0);
+    auto control = makeGeometricAsianControl(OptionType::Call, 100.0, 8);
+    auto c = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 5000, 8, asian, control, single);
+    auto d = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 5000, 8, asian, control, repricing);
+    EXPECT_EQ(c.price, d.price);
+    EXPECT_EQ(c.delta, d.delta);
+    EXPECT_EQ(c.gamma, d.gamma);
+    EXPECT_EQ(c.vega, d.vega);
+    EXPECT_EQ(c.rho, d.rho);
+    EXPECT_EQ(c.theta, d.theta);
+}
+
+TEST(MonteCarloTest, PathwiseGreeksMatchBlackScholes) {
+    static_assert(greekEstimatorOf<PayOffVanilla> == GreekEstimator::Pathwise);
+
+    PayOffVanilla payoff(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.greeks = GreeksMode::Estimators;
+    auto result = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 200000, payoff, settings);
+    auto expected = black_scholes_greeks_call_struct(100.0, 100.0, 0.05, 0.2, 1.0);
+
+    EXPECT_NEAR(result.delta, expected.delta, 0.01);
+    EXPECT_NEAR(result.gamma, expected.gamma, 0.002);
+    EXPECT_NEAR(result.vega, expected.vega, 1.0);
+    EXPECT_NEAR(result.rho, expected.rho, 1.0);
+    EXPECT_NEAR(result.theta, expected.theta, 0.5);
+}
+
+TEST(MonteCarloTest, LikelihoodRatioGreeksForDigital) {
+    static_assert(greekEstimatorOf<PayOffDigital> == GreekEstimator::LikelihoodRatio);
+
+    double S = 100.0, K = 105.0, r = 0.05, sigma = 0.2, T = 1.0;
+    PayOffDigital payoff(OptionType::Call, K);
+    MonteCarloSettings settings;
+    settings.greeks = GreeksMode::Estimators;
+    settings.antithetic = true;
+    auto result = MonteCarloPricer::priceEuropean(S, r, sigma, T, 100000, payoff, settings);
+
+    auto pdf = [](double x) { return std::exp(-0.5 * x * x) / std::sqrt(2.0 * std::numbers::pi); };
+    double d2 = (std::log(S / K) + (r - 0.5 * sigma * sigma) * T) / (sigma * std::sqrt(T));
+    double d1 = d2 + sigma * std::sqrt(T);
+    double df = std::exp(-r * T);
+    double delta = df * pdf(d2) / (S * sigma * std::sqrt(T));
+    double vega = -df * pdf(d2) * d1 / sigma;
+    double rho = -T * df * 0.5 * std::erfc(-d2 / std::numbers::sqrt2) + df * pdf(d2) * std::sqrt(T) / sigma;
+
+    EXPECT_NEAR(result.delta, delta, 0.05 * delta);
+    EXPECT_NEAR(result.vega, vega, 0.05 * std::abs(vega) + 0.01);
+    EXPECT_NEAR(result.rho, rho, 0.05 * std::abs(rho));
+}
+
+TEST(MonteCarloTest, AdjointGreeksMatchBlackScholes) {
+    PayOffVanilla payoff(OptionType::Call, 100.0);
+    auto aad = MonteCarloPricer::priceEuropeanAAD(100.0, 0.05, 0.2, 1.0, 100000, payoff);
+    auto plain = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 100000, payoff);
+    auto expected = black_scholes_greeks_call_struct(100.0, 100.0, 0.05, 0.2, 1.0);
+
+    EXPECT_EQ(aad.price, plain.price);
+    ASSERT_EQ(aad.rate_sensitivities.size(), 1u);
+    ASSERT_EQ(aad.vol_sensitivities.size(), 1u);
+    EXPECT_NEAR(aad.delta, expected.delta, 0.01);
+    EXPECT_NEAR(aad.vol_sensitivities[0], expected.vega, 0.5);
+    EXPECT_NEAR(aad.rate_sensitivities[0], expected.rho, 0.5);
+}
+
+TEST(MonteCarloTest, AdjointPricingKeepsCallerRecording) {
+    // An outer AAD calculation on this thread, mid-recording: pricing must leave its nodes and mark alone.
+    Tape& tape = Tape::local();
+    tape.clear();
+    Number x = Number::input(2.0);
+    Number y = x * x;
+    tape.mark();
+    const size_t size = tape.size();
+
+    PayOffVanilla payoff(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.threads = 1;
+    auto aad = MonteCarloPricer::priceEuropeanAAD(100.0, 0.05, 0.2, 1.0, 10000, payoff, settings);
+    EXPECT_GT(aad.delta, 0.0);
+
+    EXPECT_EQ(tape.size(), size);
+    EXPECT_EQ(tape.markPosition(), size);
+    Number z = y * 3.0;
+    z.setAdjoint(1.0);
+    tape.propagate(0, tape.size());
+    EXPECT_EQ(x.adjoint(), 12.0);
+    tape.clear();
+}
+
+TEST(MonteCarloTest, AdjointSensitivitiesToEveryParametersNode) {
+    // Four flat volatility pieces: their sensitivities add up to the flat vega.
+    Parameters sigma(std::make_unique<ParametersPiecewiseConstant>(
+        std::vector<double>{0.25, 0.5, 0.75, 1.0}, std::vector<double>{0.2, 0.2, 0.2, 0.2}));
+    PayOffAsian payoff(OptionType::Call, 100.0);
+
+    MonteCarloSettings settings;
+    settings.threads = 2;
+    settings.paths_per_batch = 4096;
+    auto nodes = MonteCarloPricer::pricePathDependentAAD(100.0, 0.05, sigma, 1.0, 20000, 12, payoff, settings);
+    auto flat = MonteCarloPricer::pricePathDependentAAD(100.0, 0.05, 0.2, 1.0, 20000, 12, payoff, settings);
+
+    ASSERT_EQ(nodes.vol_sensitivities.size(), 4u);
+    double total = 0.0;
+    for (double v : nodes.vol_sensitivities) total += v;
+    EXPECT_NEAR(total, flat.vol_sensitivities[0], 1e-8);
+    EXPECT_NEAR(nodes.price, flat.price, 1e-10);
+
+    // Averaging dampens the late volatility: earlier pieces matter more.
+    EXPECT_GT(nodes.vol_sensitivities[0], nodes.vol_sensitivities[3]);
+    EXPECT_GT(nodes.delta, 0.0);
+}
+
+TEST(MonteCarloTest, PathDependentOnFixingDates) {
+    PayOffAsian payoff(OptionType::Call, 100.0);
+
+    // A uniform TimeGrid is the same simulation as the `steps` overload.
+    auto by_steps = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 4000, 12, payoff);
+    auto by_grid = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, TimeGrid(1.0, 12), 4000, payoff);
+    EXPECT_EQ(by_steps.price, by_grid.price);
+    EXPECT_EQ(by_steps.theta, by_grid.theta);
+
+    // Non-uniform grid, terminal payoff only: must reproduce Black-Scholes.
+    auto terminal = [](const std::vector<double>& path) { return std::max(path.back() - 100.0, 0.0); };
+    TimeGrid fixings({0.02, 0.1, 0.35, 0.9, 1.0});
+    auto result = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, fixings, 40000, terminal);
+    EXPECT_NEAR(result.price, black_scholes_call(100.0, 100.0, 0.05, 0.2, 1.0), 3.0 * result.error_estimate);
+}
+
+TEST(MonteCarloTest, StreamingPayOffsMatchVectorPayOffs) {
+    // Same path draws, same running sum: the streaming Asian is the vector Asian bit for bit.
+    auto vector_asian = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 4000, 12, PayOffAsian(OptionType::Call, 100.0));
+    auto streaming_asian = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 4000, 12, StreamingAsian(OptionType::Call, 100.0));
+    EXPECT_EQ(vector_asian.price, streaming_asian.price);
+    EXPECT_EQ(vector_asian.delta, streaming_asian.delta);
+
+    // Knock-in + knock-out = vanilla on every path.
+    MonteCarloSettings settings;
+    settings.greeks = GreeksMode::Repricing;
+    auto price = [&](auto payoff) { return MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 20000, 50, payoff, settings).price; };
+    auto terminal_call = [](const std::vector<double>& path) { return std::max(path.back() - 100.0, 0.0); };
+    double vanilla = price(terminal_call);
+    double up_out = price(StreamingBarrier(BarrierType::UpAndOut, 120.0, OptionType::Call, 100.0));
+    double up_in = price(StreamingBarrier(BarrierType::UpAndIn, 120.0, OptionType::Call, 100.0));
+    EXPECT_NEAR(up_out + up_in, vanilla, 1e-10);
+    EXPECT_LT(up_out, vanilla);
+
+    // Lookbacks dominate the corresponding vanillas.
+    double floating = price(StreamingLookback(OptionType::Call));
+    double fixed = price(StreamingLookback(OptionType::Call, 100.0));
+    EXPECT_GT(floating, vanilla);
+    EXPECT_GT(fixed, vanilla);
+
+    // The cliquet is bounded by its global floor and the sum of the local caps.
+    double cliquet = price(StreamingCliquet(-0.02, 0.02, 0.0));
+    EXPECT_GE(cliquet, 0.0);
+    EXPECT_LE(cliquet, 50 * 0.02);
+}
+
+TEST(MonteCarloTest, PathBlocksMatchPathAtATime) {
+    // Same normals, vectorized exp: only the rounding of exp differs.
+    auto compare = [](auto payoff, MonteCarloSettings settings) {
+        auto scalar = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 3000, 24, payoff, settings);
+        settings.path_block = 256; // 3000 paths: the last block is partial
+        auto block = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 3000, 24, payoff, settings);
+        EXPECT_NEAR(block.price, scalar.price, 1e-12 * scalar.price);
+        EXPECT_NEAR(block.delta, scalar.delta, 1e-9);
+        EXPECT_NEAR(block.error_estimate, scalar.error_estimate, 1e-12);
+    };
+
+    MonteCarloSettings settings;
+    compare(PayOffAsian(OptionType::Call, 100.0), settings);
+    compare(StreamingAsian(OptionType::Put, 100.0), settings);
+    settings.antithetic = true;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    compare(StreamingBarrier(BarrierType::DownAndOut, 85.0, OptionType::Put, 100.0), settings);
+
+    // With a control variate.
+    MonteCarloSettings block_settings;
+    block_settings.path_block = 512;
+    auto control = makeGeometricAsianControl(OptionType::Call, 100.0, 24);
+    auto scalar = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 3000, 24, PayOffAsian(OptionType::Call, 100.0), control);
+    auto block = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 3000, 24, PayOffAsian(OptionType::Call, 100.0), control, block_settings);
+    EXPECT_NEAR(block.price, scalar.price, 1e-10);
+}
+
+TEST(MonteCarloTest, SinglePrecisionPathBlocks) {
+    MonteCarloSettings settings;
+    settings.path_block = 256;
+    settings.sampling = SamplingMethod::QuasiRandom;
+    auto dbl = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 3000, 24, StreamingAsian(OptionType::Call, 100.0), settings);
+    settings.precision = Precision::Float;
+    // Quasi-random: the same normals rounded to float, so only float rounding separates the prices.
+    auto flt = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 3000, 24, StreamingAsian(OptionType::Call, 100.0), settings);
+    EXPECT_NEAR(flt.price, dbl.price, 1e-5 * dbl.price);
+    EXPECT_NEAR(flt.delta, dbl.delta, 1e-3);
+
+    // Pseudo-random float stream against the closed form.
+    settings.sampling = SamplingMethod::PseudoRandom;
+    settings.antithetic = true;
+    auto res = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, 1.0, 50000, 12, PayOffGeometricAsian(OptionType::Call, 100.0), settings);
+    EXPECT_NEAR(res.price, geometricAsianPrice(OptionType::Call, 100.0, 100.0, 0.05, 0.2, 1.0, 12), 4.0 * res.error_estimate);
+}
+
+TEST(MonteCarloTest, PriceToToleranceStoppingRules) {
+    PayOffVanilla call(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 4096;
+
+    // Tolerance: stops at the first check below target; same paths as priceEuropean.
+    ToleranceSettings tolerance;
+    tolerance.tolerance = 0.1;
+    auto result = MonteCarloPricer::priceToTolerance(100.0, 0.05, 0.2, 1.0, call, tolerance, settings);
+    EXPECT_EQ(result.stop_reason, StopReason::Tolerance);
+    EXPECT_LE(result.error_estimate, 0.1);
+    EXPECT_EQ(result.paths % settings.paths_per_batch, 0u);
+    auto fixed = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, result.paths, call, settings);
+    EXPECT_NEAR(result.price, fixed.price, 1e-10);
+    EXPECT_NEAR(result.error_estimate, fixed.error_estimate, 1e-10);
+
+    // A riskier trade needs more paths for the same tolerance.
+    auto high_vol = MonteCarloPricer::priceToTolerance(100.0, 0.05, 0.6, 1.0, call, tolerance, settings);
+    EXPECT_GT(high_vol.paths, result.paths);
+
+    // Path budget (not a multiple of the batch size).
+    tolerance.tolerance = 1e-6;
+    tolerance.max_paths = 10000;
+    StatisticsMean gatherer;
+    auto capped = MonteCarloPricer::priceToTolerance(100.0, 0.05, 0.2, 1.0, call, gatherer, tolerance, settings);
+    EXPECT_EQ(capped.stop_reason, StopReason::MaxPaths);
+    EXPECT_EQ(capped.paths, 10000u);
+    EXPECT_EQ(gatherer.getResultsSoFar()[0][0], capped.price);
+
+    // Deadline already passed: one round, then stop.
+    tolerance.max_paths = size_t{1} << 24;
+    tolerance.deadline = std::chrono::steady_clock::now();
+    auto late = MonteCarloPricer::priceToTolerance(100.0, 0.05, 0.2, 1.0, call, tolerance, settings);
+    EXPECT_EQ(late.stop_reason, StopReason::Deadline);
+    EXPECT_EQ(late.paths, settings.paths_per_batch);
+}
+
+TEST(MonteCarloTest, AsyncBatchesMatchPriceEuropean) {
+    PayOffVanilla call(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 1000;
+    const size_t paths = 20500;
+
+    ThreadPool pool(3);
+    StatisticsWelford gatherer;
+    auto future = MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, paths, call, gatherer, settings, pool);
+    future.get();
+
+    auto reference = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, paths, call, settings);
+    GathererSnapshot snap;
+    gatherer.snapshot(snap);
+    EXPECT_EQ(snap.paths, paths);
+    EXPECT_NEAR(snap.mean, reference.price, 1e-10);
+    EXPECT_NEAR(snap.std_error, reference.error_estimate, 1e-10);
+
+    // The one-task overload runs on the library pool.
+    StatisticsMean single;
+    MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, 5000, call, single).get();
+    StatisticsMean sync;
+    MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 5000, call, sync);
+    EXPECT_EQ(single.getResultsSoFar()[0][0], sync.getResultsSoFar()[0][0]);
+}
+
+namespace {
+    // Requests a stop once it has received `limit` results.
+    struct StoppingGatherer {
+        StatisticsWelford inner;
+        std::stop_source& source;
+        size_t limit;
+        size_t count = 0;
+
+        void dumpOneResult(double result) {
+            inner.dumpOneResult(result);
+            if (++count == limit) source.request_stop();
+        }
+        std::vector<std::vector<double>> getResultsSoFar() const { return inner.getResultsSoFar(); }
+        void snapshot(GathererSnapshot& out) const { inner.snapshot(out); }
+    };
+}
+
+TEST(MonteCarloTest, AsyncCancellationReturnsPartialResult) {
+    PayOffVanilla call(OptionType::Call, 100.0);
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 1000;
+
+    // Split run on one worker: the stop lands after the third batch is gathered.
+    ThreadPool pool(1);
+    std::stop_source source;
+    StoppingGatherer gatherer{StatisticsWelford{}, source, 3000};
+    auto partial = MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, 50000, call, gatherer, settings,
+                                                        source.get_token(), std::chrono::steady_clock::time_point::max(), pool).get();
+    EXPECT_EQ(partial.stop_reason, StopReason::Cancelled);
+    EXPECT_EQ(partial.paths, 3000u);
+    auto prefix = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, 3000, call, settings);
+    EXPECT_NEAR(partial.price, prefix.price, 1e-10);
+    EXPECT_NEAR(partial.error_estimate, prefix.error_estimate, 1e-10);
+
+    // Single-task run: checked every block of 1024 paths.
+    std::stop_source single_source;
+    StoppingGatherer single{StatisticsWelford{}, single_source, 2048};
+    auto stopped = MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, 50000, call, single, single_source.get_token()).get();
+    EXPECT_EQ(stopped.stop_reason, StopReason::Cancelled);
+    EXPECT_EQ(stopped.paths, 2048u);
+
+    // Deadline already passed: nothing is simulated.
+    StatisticsMean late_gatherer;
+    auto late = MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, 50000, call, late_gatherer, settings,
+                                                     std::stop_token{}, std::chrono::steady_clock::now(), pool).get();
+    EXPECT_EQ(late.stop_reason, StopReason::Deadline);
+    EXPECT_EQ(late.paths, 0u);
+
+    // Not stopped: the whole run.
+    StatisticsMean full_gatherer;
+    auto full = MonteCarloPricer::priceEuropeanAsync(100.0, 0.05, 0.2, 1.0, 5500, call, full_gatherer, settings,
+                                                     std::stop_token{}, std::chrono::steady_clock::time_point::max(), pool).get();
+    EXPECT_EQ(full.stop_reason, StopReason::MaxPaths);
+    EXPECT_EQ(full.paths, 5500u);
+}
+
+TEST(MonteCarloTest, PortfolioMatchesSeparatePricings) {
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 2000;
+    const size_t paths = 10000;
+
+    // Option chain on terminal spots: same paths as priceEuropean for each strike.
+    std::vector<PayOffVanilla> chain;
+    for (double K = 80.0; K <= 120.0; K += 10.0) chain.emplace_back(OptionType::Call, K);
+    PayOffDigital digital(OptionType::Put, 95.0);
+    auto book = MonteCarloPricer::pricePortfolio(100.0, 0.05, 0.2, 1.0, paths, settings, chain, digital);
+    ASSERT_EQ(book.size(), chain.size() + 1);
+    EXPECT_EQ(book.paths, paths);
+    for (size_t i = 0; i < chain.size(); ++i) {
+        auto single = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, paths, chain[i], settings);
+        EXPECT_NEAR(book.price[i], single.price, 1e-10);
+        EXPECT_NEAR(book.error_estimate[i], single.error_estimate, 1e-10);
+    }
+    auto digital_single = MonteCarloPricer::priceEuropean(100.0, 0.05, 0.2, 1.0, paths, digital, settings);
+    EXPECT_NEAR(book.price.back(), digital_single.price, 1e-10);
+
+    // Mixed book on a path grid: vector, streaming and terminal payoffs together.
+    settings.antithetic = true;
+    const TimeGrid grid(1.0, 12);
+    PayOffAsian asian(OptionType::Call, 100.0);
+    StreamingAsian streaming(OptionType::Call, 100.0);
+    PayOffVanilla call(OptionType::Call, 100.0);
+    auto mixed = MonteCarloPricer::pricePortfolio(100.0, 0.05, 0.2, grid, paths, settings, asian, streaming, call);
+    ASSERT_EQ(mixed.size(), 3u);
+    auto asian_single = MonteCarloPricer::pricePathDependent(100.0, 0.05, 0.2, grid, paths, asian, settings);
+    EXPECT_NEAR(mixed.price[0], asian_single.price, 1e-10);
+    EXPECT_NEAR(mixed.error_estimate[0], asian_single.error_estimate, 1e-10);
+    EXPECT_NEAR(mixed.price[1], mixed.price[0], 1e-10);
+    EXPECT_NEAR(mixed.price[2], black_scholes_call(100.0, 100.0, 0.05, 0.2, 1.0), 4.0 * mixed.error_estimate[2]);
+}
+
+namespace {
+    // Market data without an AAD counterpart: the base class must not require ActiveMarket<>::type.
+    class PayOffBestOfTwo : public PayOff<PayOffBestOfTwo, std::array<double, 2>> {
+    public:
+        double implementation(const std::array<double, 2>& spots) const { return std::max(spots[0], spots[1]); }
+    };
+}
+
+TEST(MonteCarloTest, PayOffOnCustomMarketType) {
+    const PayOffBestOfTwo payoff;
+    EXPECT_EQ(payoff({90.0, 110.0}), 110.0);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/Cholesky.h"
+#include "GreekCore/Pricing/MonteCarlo.h"
+#include "GreekCore/Pricing/MultiAssetPayOff.h"
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace GreekCore;
+
+namespace {
+    double N(double x) { return 0.5 * std::erfc(-x / std::numbers::sqrt2); }
+
+    MultiAssetMarket twoAssets(double rho) {
+        return {{100.0, 95.0}, Parameters(0.03), {Parameters(0.25), Parameters(0.35)}, {1.0, rho, rho, 1.0}};
+    }
+}
+
+TEST(MultiAssetTest, CholeskyFactorization) {
+    const std::vector<double> C = {1.0, 0.5, 0.2,
+                                   0.5, 1.0, -0.3,
+                                   0.2, -0.3, 1.0};
+    CholeskyFactor L(C, 3);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            double sum = 0.0;
+            for (size_t k = 0; k < 3; ++k) sum += L(i, k) * L(j, k);
+            EXPECT_NEAR(sum, C[i * 3 + j], 1e-14);
+        }
+    }
+    EXPECT_EQ(L(0, 2), 0.0);
+
+    // Block product = one product per vector.
+    const size_t block = 5;
+    std::vector<double> z(3 * block), x(3 * block), zi(3), xi(3);
+    for (size_t k = 0; k < z.size(); ++k) z[k] = std::sin(1.0 + k);
+    L.multiplyBlock(z, x, block);
+    for (size_t p = 0; p < block; ++p) {
+        for (size_t i = 0; i < 3; ++i) zi[i] = z[i * block + p];
+        L.multiply(zi, xi);
+        for (size_t i = 0; i < 3; ++i) EXPECT_NEAR(x[i * block + p], xi[i], 1e-15);
+    }
+
+    const std::vector<double> not_pd = {1.0, 2.0, 2.0, 1.0};
+    EXPECT_THROW(CholeskyFactor(not_pd, 2), std::invalid_argument);
+    EXPECT_THROW(CholeskyFactor(C, 2), std::invalid_argument);
+}
+
+TEST(MultiAssetTest, ExchangeOptionMatchesMargrabe) {
+    const double rho = 0.5, T = 1.0;
+    const MultiAssetMarket market = twoAssets(rho);
+    MonteCarloSettings settings;
+    settings.antithetic = true;
+
+    auto mc = MonteCarloPricer::priceMultiAsset(market, T, 200000, PayOffSpread(OptionType::Call, 0.0), settings);
+
+    const double sigma = std::sqrt(0.25 * 0.25 + 0.35 * 0.35 - 2.0 * rho * 0.25 * 0.35);
+    const double d1 = (std::log(100.0 / 95.0) + 0.5 * sigma * sigma * T) / (sigma * std::sqrt(T));
+    const double margrabe = 100.0 * N(d1) - 95.0 * N(d1 - sigma * std::sqrt(T));
+    EXPECT_NEAR(mc.price, margrabe, 4.0 * mc.error_estimate);
+    EXPECT_EQ(mc.paths, 200000u);
+
+    // A one-asset basket is a vanilla call.
+    auto basket = MonteCarloPricer::priceMultiAsset(market, T, 200000, PayOffBasket(OptionType::Call, {1.0, 0.0}, 100.0), settings);
+    const double bs_d1 = (0.03 + 0.5 * 0.25 * 0.25) / 0.25;
+    const double bs = 100.0 * N(bs_d1) - 100.0 * std::exp(-0.03) * N(bs_d1 - 0.25);
+    EXPECT_NEAR(basket.price, bs, 4.0 * basket.error_estimate);
+
+    // Worst-of <= best-of, and correlation lowers the best-of.
+    PayOffRainbow best(RainbowType::BestOf, OptionType::Call, market.spots, 1.0);
+    PayOffRainbow worst(RainbowType::WorstOf, OptionType::Call, market.spots, 1.0);
+    auto best_price = MonteCarloPricer::priceMultiAsset(market, T, 50000, best, settings);
+    auto worst_price = MonteCarloPricer::priceMultiAsset(market, T, 50000, worst, settings);
+    auto best_correlated = MonteCarloPricer::priceMultiAsset(twoAssets(0.9), T, 50000, best, settings);
+    EXPECT_LT(worst_price.price, best_price.price);
+    EXPECT_LT(best_correlated.price, best_price.price);
+}
+
+TEST(MultiAssetTest, PathPayOffsAndThreads) {
+    const MultiAssetMarket market = twoAssets(-0.4);
+    const TimeGrid grid(1.0, 6);
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 1000;
+    const size_t paths = 3100; // not a multiple of the block size
+
+    // The same payoff through the path view sees the same terminal spots.
+    PayOffBasket basket(OptionType::Put, {0.5, 0.5}, 100.0);
+    auto on_path = [&basket](const MultiAssetPath& path) { return basket(path.terminal()); };
+    auto terminal = MonteCarloPricer::priceMultiAsset(market, grid, paths, basket, settings);
+    auto path = MonteCarloPricer::priceMultiAsset(market, grid, paths, on_path, settings);
+    EXPECT_EQ(path.price, terminal.price);
+
+    // Averaging basket over the grid (an Asian basket).
+    auto asian = [](const MultiAssetPath& p) {
+        double sum = 0.0;
+        for (size_t j = 0; j < p.steps(); ++j) sum += 0.5 * (p.spot(j, 0) + p.spot(j, 1));
+        return std::max(sum / p.steps() - 100.0, 0.0);
+    };
+    auto single = MonteCarloPricer::priceMultiAsset(market, grid, paths, asian, settings);
+    settings.threads = 3;
+    auto threaded = MonteCarloPricer::priceMultiAsset(market, grid, paths, asian, settings);
+    EXPECT_EQ(single.price, threaded.price);
+    EXPECT_GT(single.price, 0.0);
+}
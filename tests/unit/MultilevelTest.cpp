@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Pricing/ControlVariate.h"
+#include "GreekCore/Pricing/MonteCarlo.h"
+#include "GreekCore/Pricing/PayOff.h"
+#include <cmath>
+
+using namespace GreekCore;
+
+TEST(MultilevelTest, GeometricAsianReachesTargetRMSE) {
+    // Continuously averaged geometric Asian (the discrete formula on a very fine grid).
+    const double reference = geometricAsianPrice(OptionType::Call, 100.0, 100.0, 0.05, 0.3, 1.0, 1 << 16);
+    MultilevelSettings mlmc;
+    mlmc.target_rmse = 0.02;
+    mlmc.base_steps = 2;
+    auto result = MonteCarloPricer::priceMultilevel(100.0, 0.05, 0.3, 1.0, PayOffGeometricAsian(OptionType::Call, 100.0), mlmc);
+
+    EXPECT_TRUE(result.converged);
+    EXPECT_NEAR(result.price, reference, 3.0 * mlmc.target_rmse);
+    EXPECT_LE(result.error_estimate, mlmc.target_rmse / std::sqrt(2.0) * 1.01);
+    ASSERT_GE(result.levels.size(), 3u);
+
+    // The corrections shrink with the level (variance ~ 2^-2l for a Lipschitz average), and so
+    // does the number of paths needed on each level.
+    for (size_t l = 2; l < result.levels.size(); ++l) {
+        EXPECT_EQ(result.levels[l].steps, 2 * result.levels[l - 1].steps);
+        EXPECT_LT(result.levels[l].variance, result.levels[l - 1].variance);
+        EXPECT_LE(result.levels[l].paths, result.levels[l - 1].paths);
+    }
+}
+
+TEST(MultilevelTest, TerminalPayoffHasNoCorrections) {
+    // Exact GBM steps: coarse and fine terminal spots coincide, so every correction is 0 and the
+    // driver stops after the pilot levels.
+    MultilevelSettings mlmc;
+    mlmc.target_rmse = 0.05;
+    auto result = MonteCarloPricer::priceMultilevel(100.0, 0.03, 0.2, 1.0, PayOffVanilla(OptionType::Call, 100.0), mlmc);
+    ASSERT_EQ(result.levels.size(), mlmc.min_levels);
+    for (size_t l = 1; l < result.levels.size(); ++l) {
+        EXPECT_EQ(result.levels[l].variance, 0.0);
+        EXPECT_NEAR(result.levels[l].mean, 0.0, 1e-13);
+    }
+    const double d1 = (0.03 + 0.02) / 0.2, d2 = d1 - 0.2;
+    const double bs = 100.0 * (0.5 * std::erfc(-d1 / std::sqrt(2.0)) - std::exp(-0.03) * 0.5 * std::erfc(-d2 / std::sqrt(2.0)));
+    EXPECT_NEAR(result.price, bs, 3.0 * mlmc.target_rmse);
+}
+
+TEST(MultilevelTest, ReproducibleAcrossThreads) {
+    MultilevelSettings mlmc;
+    mlmc.target_rmse = 0.05;
+    MonteCarloSettings settings;
+    settings.paths_per_batch = 2048;
+    StreamingAsian asian(OptionType::Put, 100.0);
+    auto serial = MonteCarloPricer::priceMultilevel(100.0, 0.05, 0.3, 1.0, asian, mlmc, settings);
+    settings.threads = 3;
+    auto parallel = MonteCarloPricer::priceMultilevel(100.0, 0.05, 0.3, 1.0, asian, mlmc, settings);
+    EXPECT_EQ(serial.price, parallel.price);
+    EXPECT_EQ(serial.levels.size(), parallel.levels.size());
+
+    // Any mergeable gatherer collects the corrections.
+    auto mean = MonteCarloPricer::priceMultilevel<StreamingAsian, StatisticsMean>(100.0, 0.05, 0.3, 1.0, asian, mlmc, settings);
+    EXPECT_NEAR(mean.price, serial.price, 1e-9);
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/RNG.h"
+
+using namespace GreekCore;
+
+TEST(RNGTest, StreamMatchesRepeatedJumps) {
+    StreamFactory factory(2024);
+    Xoshiro256 sequential(2024);
+
+    for (uint64_t k = 0; k < 70; ++k) {
+        Xoshiro256 fast = factory.stream(k);
+        EXPECT_EQ(fast.s, sequential.s) << "stream " << k;
+        sequential.jump();
+    }
+}
+
+TEST(RNGTest, LongJumpEqualsTwoToTheSixtyFourJumps) {
+    // J^(2^63) applied twice is J^(2^64), which is exactly the 2^192-step long jump.
+    StreamFactory factory(7);
+    Xoshiro256 half = factory.stream(uint64_t{1} << 63);
+    Xoshiro256 full = StreamFactory(half).stream(uint64_t{1} << 63);
+
+    Xoshiro256 expected(7);
+    expected.long_jump();
+    EXPECT_EQ(full.s, expected.s);
+}
+
+TEST(RNGTest, StreamsProduceDifferentSequences) {
+    StreamFactory factory(42);
+    Xoshiro256 a = factory.stream(1);
+    Xoshiro256 b = factory.stream(2);
+
+    int equal = 0;
+    for (int i = 0; i < 1000; ++i) {
+        if (a() == b()) ++equal;
+    }
+    EXPECT_EQ(equal, 0);
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/Sobol.h"
+#include "GreekCore/Numerics/BrownianBridge.h"
+#include "GreekCore/Numerics/NormalDistribution.h"
+#include <vector>
+#include <cmath>
+
+using namespace GreekCore;
+
+TEST(SobolTest, FirstPointsOfUnscrambledSequence) {
+    SobolSequence sobol(2);
+    std::vector<double> x(2);
+    const double half_ulp = 0.5 * 0x1.0p-32;
+
+    sobol.next(x);
+    EXPECT_DOUBLE_EQ(x[0], 0.5 + half_ulp);
+    EXPECT_DOUBLE_EQ(x[1], 0.5 + half_ulp);
+    sobol.next(x);
+    EXPECT_DOUBLE_EQ(x[0], 0.75 + half_ulp);
+    EXPECT_DOUBLE_EQ(x[1], 0.25 + half_ulp);
+    sobol.next(x);
+    EXPECT_DOUBLE_EQ(x[0], 0.25 + half_ulp);
+    EXPECT_DOUBLE_EQ(x[1], 0.75 + half_ulp);
+}
+
+TEST(SobolTest, SkipToMatchesSequentialGeneration) {
+    SobolSequence sequential(300, SobolScrambling::Owen, 9);
+    SobolSequence skipped(300, SobolScrambling::Owen, 9);
+    std::vector<double> a(300), b(300);
+
+    for (int i = 0; i < 777; ++i) sequential.next(a);
+    skipped.skipTo(777);
+    sequential.next(a);
+    skipped.next(b);
+    EXPECT_EQ(a, b);
+}
+
+TEST(SobolTest, ScrambledPointsAreStratified) {
+    // The first 2^m points of a (scrambled) Sobol sequence put exactly one point in each
+    // interval [k/2^m, (k+1)/2^m) of every coordinate.
+    const size_t dim = 64;
+    const size_t n = 1024;
+    for (SobolScrambling scrambling : {SobolScrambling::DigitalShift, SobolScrambling::Owen}) {
+        SobolSequence sobol(dim, scrambling, 2024);
+        std::vector<std::vector<int>> hits(dim, std::vector<int>(n, 0));
+        std::vector<double> x(dim);
+        for (size_t i = 0; i < n; ++i) {
+            sobol.next(x);
+            for (size_t d = 0; d < dim; ++d) hits[d][static_cast<size_t>(x[d] * n)]++;
+        }
+        for (size_t d = 0; d < dim; ++d) {
+            for (size_t k = 0; k < n; ++k) ASSERT_EQ(hits[d][k], 1) << "dim " << d << " cell " << k;
+        }
+    }
+}
+
+TEST(SobolTest, RejectsUnsupportedDimension) {
+    EXPECT_THROW(SobolSequence(0), std::invalid_argument);
+    EXPECT_THROW(SobolSequence(SobolSequence::kMaxDimension + 1), std::invalid_argument);
+}
+
+TEST(SobolTest, InverseCumulativeNormalRoundTrips) {
+    for (double u : {1e-12, 1e-6, 0.01, 0.2, 0.5, 0.7, 0.99, 1.0 - 1e-9}) {
+        EXPECT_NEAR(cumulativeNormal(inverseCumulativeNormal(u)), u, 1e-15 + 1e-12 * u);
+    }
+}
+
+TEST(BrownianBridgeTest, TransformIsOrthogonal) {
+    // Standardized increments of a Brownian path are i.i.d. N(0,1), so the bridge must map
+    // the identity covariance to itself: its matrix is orthogonal.
+    std::vector<double> times = {0.1, 0.25, 0.3, 0.7, 1.0, 1.5, 2.0};
+    BrownianBridge bridge(times);
+    const size_t n = times.size();
+
+    std::vector<std::vector<double>> columns(n, std::vector<double>(n));
+    for (size_t i = 0; i < n; ++i) {
+        std::vector<double> e(n, 0.0);
+        e[i] = 1.0;
+        bridge.transform(e, columns[i]);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            double dot = 0.0;
+            for (size_t k = 0; k < n; ++k) dot += columns[i][k] * columns[j][k];
+            EXPECT_NEAR(dot, i == j ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+TEST(BrownianBridgeTest, FirstNormalDrivesTerminalValue) {
+    BrownianBridge bridge(8);
+    std::vector<double> z(8, 0.0), out(8);
+    z[0] = 1.0;
+    bridge.transform(z, out);
+
+    // W(T) = sqrt(T) with straight-line interpolation: every standardized increment is 1/sqrt(n).
+    for (double x : out) EXPECT_NEAR(x, 1.0 / std::sqrt(8.0), 1e-14);
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/Statistics.h"
+#include "GreekCore/Numerics/DistributionStatistics.h"
+#include "GreekCore/Numerics/NormalGenerator.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace GreekCore;
+
+TEST(StatisticsTest, SnapshotMatchesResultsSoFar) {
+    StatisticsMean mean;
+    for (double x : {1.0, 2.0, 4.0, 8.0}) mean.dumpOneResult(x);
+
+    GathererSnapshot snap;
+    mean.snapshot(snap);
+    auto results = mean.getResultsSoFar();
+    EXPECT_EQ(snap.mean, results[0][0]);
+    EXPECT_EQ(snap.std_error, results[0][1]);
+    EXPECT_EQ(snap.paths, 4u);
+    EXPECT_DOUBLE_EQ(snap.mean, 3.75);
+
+    StatisticsMeanLockFree lock_free;
+    for (double x : {1.0, 2.0, 4.0, 8.0}) lock_free.dumpOneResult(x);
+    GathererSnapshot lock_free_snap;
+    lock_free.snapshot(lock_free_snap);
+    EXPECT_EQ(lock_free_snap.mean, snap.mean);
+    EXPECT_EQ(lock_free_snap.std_error, snap.std_error);
+
+    StatisticsThreadSafe<StatisticsMean> thread_safe(mean);
+    GathererSnapshot thread_safe_snap;
+    thread_safe.snapshot(thread_safe_snap);
+    EXPECT_EQ(thread_safe_snap.mean, snap.mean);
+}
+
+TEST(StatisticsTest, ConvergenceLogKeepsLayout) {
+    StatisticsConvergence<StatisticsMean> convergence(StatisticsMean{}, {2, 4});
+    for (double x : {1.0, 3.0, 5.0, 7.0, 9.0}) convergence.dumpOneResult(x);
+
+    auto log = convergence.getResultsSoFar(); // [PathCount, Mean, Err] per stopping point + current
+    ASSERT_EQ(log.size(), 3u);
+    EXPECT_EQ(log[0][0], 2.0);
+    EXPECT_DOUBLE_EQ(log[0][1], 2.0);
+    EXPECT_EQ(log[1][0], 4.0);
+    EXPECT_DOUBLE_EQ(log[1][1], 4.0);
+    EXPECT_EQ(log[2][0], 5.0);
+    EXPECT_DOUBLE_EQ(log[2][1], 5.0);
+
+    ASSERT_EQ(convergence.getSnapshotLog().size(), 2u);
+    EXPECT_EQ(convergence.getSnapshotLog()[1].paths, 4u);
+}
+
+TEST(StatisticsTest, WelfordMergeMatchesSinglePass) {
+    static_assert(MergeableGatherer<StatisticsWelford>);
+    static_assert(MergeableGatherer<StatisticsMean>);
+
+    // Large offset: the sum / sum-of-squares formula loses most digits of the variance here.
+    StatisticsWelford all, left, right;
+    for (int i = 0; i < 1000; ++i) {
+        const double x = 1e8 + (i % 7);
+        all.dumpOneResult(x);
+        (i < 300 ? left : right).dumpOneResult(x);
+    }
+    left.merge(right);
+
+    EXPECT_EQ(left.state().count, 1000u);
+    EXPECT_NEAR(left.state().mean, all.state().mean, 1e-7);
+    EXPECT_NEAR(left.state().m2, all.state().m2, 1e-8 * all.state().m2);
+
+    double sum = 0.0, sum_sq = 0.0;
+    for (int i = 0; i < 1000; ++i) {
+        sum += (i % 7);
+        sum_sq += (i % 7) * (i % 7);
+    }
+    const double exact_m2 = sum_sq - sum * sum / 1000.0;
+    EXPECT_NEAR(all.state().m2, exact_m2, 1e-6 * exact_m2);
+}
+
+TEST(StatisticsTest, ShardedGatherer) {
+    static_assert(MergeableGatherer<StatisticsSharded> && SnapshotGatherer<StatisticsSharded>);
+
+    // More threads than shards: the last ones go through the overflow accumulator.
+    StatisticsSharded gatherer(4);
+    std::vector<std::jthread> threads;
+    for (int t = 0; t < 6; ++t) {
+        threads.emplace_back([&gatherer, t] {
+            for (int i = 0; i < 10000; ++i) gatherer.dumpOneResult(t);
+        });
+    }
+    threads.clear(); // join
+
+    GathererSnapshot snap;
+    gatherer.snapshot(snap);
+    EXPECT_EQ(snap.paths, 60000u);
+    EXPECT_NEAR(snap.mean, 2.5, 1e-12); // shard contents depend on the thread interleaving
+
+    // Explicit shards and merge.
+    StatisticsSharded other(2);
+    other.shard(0).dumpOneResult(10.0);
+    other.shard(1).dumpOneResult(20.0);
+    gatherer.merge(other);
+    gatherer.snapshot(snap);
+    EXPECT_EQ(snap.paths, 60002u);
+    EXPECT_NEAR(snap.mean, (150000.0 + 30.0) / 60002.0, 1e-12);
+}
+
+TEST(StatisticsTest, ShardedGathererAlternatingWriters) {
+    // Two threads interleave results between two gatherers: each thread keeps its own shard
+    // in both, so nothing spills into the overflow accumulator.
+    StatisticsSharded a(2), b(2);
+    for (int t = 0; t < 2; ++t) {
+        std::jthread([&a, &b, t] {
+            for (int i = 0; i < 1000; ++i) {
+                a.dumpOneResult(t);
+                b.dumpOneResult(10.0 + t);
+            }
+        });
+    }
+    for (StatisticsSharded* gatherer : {&a, &b}) {
+        EXPECT_EQ(gatherer->shard(0).load().count, 1000u);
+        EXPECT_EQ(gatherer->shard(1).load().count, 1000u);
+        EXPECT_EQ(gatherer->state().count, 2000u);
+    }
+    EXPECT_EQ(a.shard(1).load().mean, 1.0);
+    EXPECT_EQ(b.shard(0).load().mean, 10.0);
+}
+
+namespace {
+    std::vector<double> normalSample(uint64_t seed, size_t n) {
+        std::vector<double> z(n);
+        NormalBatchGenerator(Xoshiro256(seed)).fill(z);
+        return z;
+    }
+
+    // Exact quantile / lower-tail mean of a sample, same conventions as StatisticsHistogram.
+    double sampleQuantile(std::vector<double> x, double p) {
+        std::sort(x.begin(), x.end());
+        return x[static_cast<size_t>(p * (x.size() - 1))];
+    }
+    double sampleLowerTailMean(std::vector<double> x, double p) {
+        std::sort(x.begin(), x.end());
+        const size_t k = static_cast<size_t>(p * x.size());
+        double sum = 0.0;
+        for (size_t i = 0; i < k; ++i) sum += x[i];
+        return sum / k;
+    }
+}
+
+TEST(StatisticsTest, P2QuantilesOfNormalSample) {
+    static_assert(MergeableGatherer<StatisticsP2Quantile>);
+    const auto z = normalSample(17, 200000);
+    StatisticsP2Quantile gatherer({0.01, 0.5, 0.99});
+    for (double x : z) gatherer.dumpOneResult(x);
+
+    EXPECT_NEAR(gatherer.quantile(0), sampleQuantile(z, 0.01), 0.05);
+    EXPECT_NEAR(gatherer.quantile(1), sampleQuantile(z, 0.5), 0.01);
+    EXPECT_NEAR(gatherer.quantile(2), sampleQuantile(z, 0.99), 0.05);
+
+    auto rows = gatherer.getResultsSoFar();
+    ASSERT_EQ(rows.size(), 4u);
+    EXPECT_EQ(rows[3][0], 0.99);
+    EXPECT_EQ(rows[3][1], gatherer.quantile(2));
+
+    // Two shards merged: close to the single-stream estimate.
+    StatisticsP2Quantile left({0.01, 0.5, 0.99}), right({0.01, 0.5, 0.99});
+    for (size_t i = 0; i < z.size(); ++i) (i < 70000 ? left : right).dumpOneResult(z[i]);
+    left.merge(right);
+    for (size_t i = 0; i < 3; ++i) EXPECT_NEAR(left.quantile(i), gatherer.quantile(i), 0.05);
+    EXPECT_NEAR(left.getResultsSoFar()[0][0], gatherer.getResultsSoFar()[0][0], 1e-12);
+
+    // Fewer than five results: exact interpolation of the sample.
+    P2Quantile small(0.5);
+    for (double x : {3.0, 1.0, 2.0}) small.add(x);
+    EXPECT_EQ(small.value(), 2.0);
+}
+
+TEST(StatisticsTest, HistogramQuantilesAndTails) {
+    static_assert(MergeableGatherer<StatisticsHistogram>);
+    auto pnl = normalSample(23, 100000);
+    for (double& x : pnl) x = 1000.0 * x + 50.0;
+
+    StatisticsHistogram histogram(1e-3, 1e9, 100); // bucket width 2.3%
+    StatisticsHistogram first(1e-3, 1e9, 100), second(1e-3, 1e9, 100);
+    for (size_t i = 0; i < pnl.size(); ++i) {
+        histogram.dumpOneResult(pnl[i]);
+        (i % 3 == 0 ? first : second).dumpOneResult(pnl[i]);
+    }
+
+    for (double p : {0.001, 0.01, 0.25, 0.75, 0.99}) {
+        const double exact = sampleQuantile(pnl, p);
+        EXPECT_NEAR(histogram.quantile(p), exact, 0.025 * std::abs(exact) + 1.0) << "p = " << p;
+    }
+    const double exact_es = -sampleLowerTailMean(pnl, 0.01);
+    EXPECT_NEAR(histogram.expectedShortfall(0.99), exact_es, 0.01 * exact_es);
+    EXPECT_GT(histogram.expectedShortfall(0.99), histogram.valueAtRisk(0.99));
+
+    // Merging is exact.
+    first.merge(second);
+    EXPECT_EQ(first.count(), histogram.count());
+    EXPECT_EQ(first.quantile(0.01), histogram.quantile(0.01));
+    EXPECT_NEAR(first.expectedShortfall(0.975), histogram.expectedShortfall(0.975), 1e-9);
+
+    // Extremes beyond the bucket range land in the overflow buckets.
+    StatisticsHistogram narrow(1.0, 10.0, 10);
+    for (double x : {-50.0, -5.0, 0.5, 5.0, 50.0}) narrow.dumpOneResult(x);
+    EXPECT_EQ(narrow.quantile(0.0), -50.0);
+    EXPECT_EQ(narrow.quantile(1.0), 50.0);
+    EXPECT_EQ(narrow.getResultsSoFar().size(), 6u);
+}
+
+TEST(StatisticsTest, ExpectedShortfallOfStandardNormal) {
+    static_assert(MergeableGatherer<StatisticsExpectedShortfall>);
+    const auto z = normalSample(29, 400000);
+    StatisticsExpectedShortfall gatherer({0.975, 0.99});
+    for (double x : z) gatherer.dumpOneResult(x);
+
+    // VaR_97.5 = 1.95996, ES_97.5 = phi(1.95996) / 0.025 = 2.33780
+    EXPECT_NEAR(gatherer.valueAtRisk(0), 1.95996, 0.03);
+    EXPECT_NEAR(gatherer.expectedShortfall(0), 2.33780, 0.03);
+
+    auto rows = gatherer.getResultsSoFar();
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_EQ(rows[1][0], 0.975);
+    EXPECT_EQ(rows[1][2], gatherer.expectedShortfall(0));
+    EXPECT_EQ(rows[2][1], gatherer.valueAtRisk(1));
+}
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Utils/ThreadPool.h"
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace GreekCore;
+
+TEST(ThreadPoolTest, SubmitReturnsResultsAndExceptions) {
+    ThreadPool pool(2);
+    EXPECT_EQ(pool.size(), 2u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i) results.push_back(pool.submit([i]() { return i * i; }));
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(results[i].get(), i * i);
+
+    auto failing = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, NestedTasksHelpInsteadOfBlocking) {
+    // A single worker waiting on its own sub-tasks must run them itself.
+    ThreadPool pool(1);
+    auto outer = pool.submit([&pool]() {
+        std::atomic<int> sum{0};
+        std::atomic<int> remaining{64};
+        for (int i = 1; i <= 64; ++i) {
+            pool.execute([i, &sum, &remaining]() {
+                sum.fetch_add(i);
+                remaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        pool.helpUntil([&remaining]() { return remaining.load(std::memory_order_acquire) == 0; });
+        return sum.load();
+    });
+    EXPECT_EQ(outer.get(), 64 * 65 / 2);
+}
+
+TEST(ThreadPoolTest, DestructorRunsQueuedTasks) {
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(3);
+        for (int i = 0; i < 1000; ++i) pool.execute([&done]() { done.fetch_add(1); });
+    }
+    EXPECT_EQ(done.load(), 1000);
+}
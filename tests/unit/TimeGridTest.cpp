@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Pricing/TimeGrid.h"
+#include <cmath>
+#include <stdexcept>
+
+using namespace GreekCore;
+
+TEST(TimeGridTest, UniformAndExplicitGrids) {
+    TimeGrid uniform(2.0, 8);
+    ASSERT_EQ(uniform.size(), 8u);
+    EXPECT_DOUBLE_EQ(uniform[0], 0.25);
+    EXPECT_NEAR(uniform[7], 2.0, 1e-15);
+    EXPECT_EQ(uniform.maturity(), 2.0);
+
+    TimeGrid fixings({0.1, 0.5, 1.5});
+    EXPECT_EQ(fixings.maturity(), 1.5);
+    TimeGrid shorter = fixings.rescaled(0.75);
+    EXPECT_DOUBLE_EQ(shorter[0], 0.05);
+    EXPECT_DOUBLE_EQ(shorter[2], 0.75);
+
+    EXPECT_THROW(TimeGrid(std::vector<double>{0.5, 0.5}), std::invalid_argument);
+    EXPECT_THROW(TimeGrid(std::vector<double>{}), std::invalid_argument);
+    EXPECT_THROW(TimeGrid(1.0, 0), std::invalid_argument);
+}
+
+TEST(TimeGridTest, TableIntegratesParametersOverEachStep) {
+    Parameters r(0.03);
+    Parameters sigma(std::make_unique<ParametersPiecewiseConstant>(
+        std::vector<double>{0.5, 2.0}, std::vector<double>{0.1, 0.3}));
+    TimeGrid grid({0.25, 1.0, 2.0});
+
+    DriftDiffusionTable table(grid, r, sigma);
+    ASSERT_EQ(table.size(), 3u);
+
+    // Step 2 spans [0.25, 1.0]: 0.25 at 10% then 0.5 at 30%
+    double var = 0.25 * 0.01 + 0.5 * 0.09;
+    EXPECT_NEAR(table.diffusion()[1], std::sqrt(var), 1e-15);
+    EXPECT_NEAR(table.drift()[1], 0.03 * 0.75 - 0.5 * var, 1e-15);
+    EXPECT_NEAR(table.discountFactor(), std::exp(-0.06), 1e-15);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "GreekCore/Numerics/VectorMath.h"
+#include <vector>
+#include <cmath>
+
+using namespace GreekCore;
+
+TEST(VectorMathTest, ExpWithinOneUlpOfLibm) {
+    std::vector<double> x;
+    for (double v = -700.0; v <= 700.0; v += 0.0137) x.push_back(v);
+    for (double v = -1e-6; v <= 1e-6; v += 1.3e-9) x.push_back(v);
+    std::vector<double> out(x.size());
+    expBatch(x, out);
+
+    for (size_t i = 0; i < x.size(); ++i) {
+        const double reference = std::exp(x[i]);
+        ASSERT_LE(std::abs(out[i] - reference), std::nextafter(reference, INFINITY) - reference) << "x = " << x[i];
+    }
+
+    std::vector<double> zero = {0.0}, one(1);
+    expBatch(zero, one);
+    EXPECT_EQ(one[0], 1.0);
+}
+
+TEST(VectorMathTest, AllInstructionSetsAreBitIdentical) {
+    const size_t n = 1001; // not a multiple of any vector width
+    std::vector<double> z(n), x(n);
+    NormalBatchGenerator(Xoshiro256(3)).fill(z);
+    for (size_t i = 0; i < n; ++i) x[i] = 5.0 * z[i];
+
+    const size_t dim = 7, block = n / dim; // 7 x 143 factor-major block
+    std::vector<double> lower(dim * dim, 0.0);
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j <= i; ++j) lower[i * dim + j] = z[i * dim + j];
+    }
+
+    std::vector<double> exp_scalar(n), spot_scalar(n, 100.0), product_scalar(dim * block);
+    expBatch(x, exp_scalar, SimdLevel::Scalar);
+    lognormalStep(spot_scalar, z, 0.001, 0.02, SimdLevel::Scalar);
+    lowerTriangularMultiply(lower, dim, z, product_scalar, block, SimdLevel::Scalar);
+
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        std::vector<double> exp_out(n), spot(n, 100.0);
+        expBatch(x, exp_out, level);
+        lognormalStep(spot, z, 0.001, 0.02, level);
+        std::vector<double> product(dim * block);
+        lowerTriangularMultiply(lower, dim, z, product, block, level);
+        for (size_t i = 0; i < product.size(); ++i) ASSERT_EQ(product[i], product_scalar[i]) << "level " << static_cast<int>(level);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(exp_out[i], exp_scalar[i]) << "level " << static_cast<int>(level) << " index " << i;
+            ASSERT_EQ(spot[i], spot_scalar[i]) << "level " << static_cast<int>(level) << " index " << i;
+        }
+    }
+}
+
+TEST(VectorMathTest, FloatKernels) {
+    std::vector<float> x;
+    for (float v = -87.0f; v <= 88.0f; v += 0.0137f) x.push_back(v);
+    std::vector<float> out(x.size());
+    expBatch(x, out);
+    for (size_t i = 0; i < x.size(); ++i) {
+        const float reference = static_cast<float>(std::exp(static_cast<double>(x[i])));
+        ASSERT_LE(std::abs(out[i] - reference), 2.0f * (std::nextafter(reference, INFINITY) - reference)) << "x = " << x[i];
+    }
+
+    // Bit-identical across instruction sets, for exp and the log-normal step.
+    const size_t n = 1001;
+    std::vector<float> z(n), spot_scalar(n, 100.0f), exp_scalar(n);
+    NormalBatchGenerator(Xoshiro256(3)).fill(z);
+    expBatch(std::span<const float>(x.data(), n), exp_scalar, SimdLevel::Scalar);
+    lognormalStep(spot_scalar, z, 0.001f, 0.02f, SimdLevel::Scalar);
+    for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        std::vector<float> exp_out(n), spot(n, 100.0f);
+        expBatch(std::span<const float>(x.data(), n), exp_out, level);
+        lognormalStep(spot, z, 0.001f, 0.02f, level);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(exp_out[i], exp_scalar[i]) << "level " << static_cast<int>(level) << " index " << i;
+            ASSERT_EQ(spot[i], spot_scalar[i]) << "level " << static_cast<int>(level) << " index " << i;
+        }
+    }
+    EXPECT_NEAR(spot_scalar[0], 100.0 * std::exp(0.001 + 0.02 * z[0]), 1e-4);
+}
+
+TEST(VectorMathTest, LognormalStep) {
+    std::vector<double> spot = {100.0, 50.0, 1.0};
+    std::vector<double> z = {0.5, -1.0, 2.0};
+    lognormalStep(spot, z, 0.01, 0.2);
+    EXPECT_NEAR(spot[0], 100.0 * std::exp(0.01 + 0.2 * 0.5), 1e-12);
+    EXPECT_NEAR(spot[1], 50.0 * std::exp(0.01 - 0.2), 1e-12);
+    EXPECT_NEAR(spot[2], std::exp(0.01 + 0.4), 1e-14);
+}
+
+TEST(VectorMathTest, LowerTriangularMultiply) {
+    // L = [[2, 0], [1, 3]] applied to the block {(1, 2), (-1, 4), (0.5, 0)}.
+    std::vector<double> lower = {2.0, 0.0, 1.0, 3.0};
+    std::vector<double> z = {1.0, -1.0, 0.5, 2.0, 4.0, 0.0};
+    std::vector<double> x(6);
+    lowerTriangularMultiply(lower, 2, z, x, 3);
+    EXPECT_EQ(x, (std::vector<double>{2.0, -2.0, 1.0, 7.0, 11.0, 0.5}));
+}
@@ -138,3 +138,31 @@ TEST_F(YieldCurveTest, BootstrapsRealWorldData) {
     double pv = C * delta1 * df_1y + (1.0 + C * delta2) * df_2y;
     EXPECT_NEAR(pv, 1.0, 1e-6);
 }
+
+TEST_F(YieldCurveTest, QuoteJacobianMatchesBumpedCurves) {
+    YieldCurve curve(today, inputs);
+    const auto& jacobian = curve.getQuoteJacobian();
+    ASSERT_EQ(jacobian.size(), inputs.size() + 1);
+
+    const double bump = 1e-6;
+    const double t = 1.5;
+    std::vector<double> df_sens = curve.getDiscountFactorSensitivities(t);
+
+    for (size_t q = 0; q < inputs.size(); ++q) {
+        auto up = inputs;
+        auto down = inputs;
+        up[q].rate += bump;
+        down[q].rate -= bump;
+        YieldCurve curve_up(today, up);
+        YieldCurve curve_down(today, down);
+
+        for (size_t k = 1; k <= inputs.size(); ++k) {
+            Date d = inputs[k - 1].maturity_date;
+            double fd = (std::log(curve_up.getDiscountFactor(d)) - std::log(curve_down.getDiscountFactor(d))) / (2.0 * bump);
+            EXPECT_NEAR(jacobian[k][q], fd, 1e-5) << "pillar " << k << " quote " << q;
+        }
+
+        double fd_df = (curve_up.getDiscountFactor(t) - curve_down.getDiscountFactor(t)) / (2.0 * bump);
+        EXPECT_NEAR(df_sens[q], fd_df, 1e-5) << "quote " << q;
+    }
+}